@@ -0,0 +1,43 @@
+#include "talawa/core/Tuning.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "talawa/core/Matrix.hpp"
+#include "talawa/utils/Timer.hpp"
+
+// Measures the best GEMM/transpose configuration for this host and writes
+// it to the tuning file, which every later run loads at startup.
+// Usage: Autotune.benchmark [tuning-file]
+using namespace talawa::core;
+
+void benchmark_dot(const std::string& label, int size) {
+  Matrix a = Matrix::random(size, size);
+  Matrix b = Matrix::random(size, size);
+  Matrix c(size, size);
+  a.dot(b, c);  // Warm up pack buffers and the thread pool
+
+  MEASURE_SCOPE(label + " " + std::to_string(size) + "x" +
+                std::to_string(size) + " dot");
+  for (int i = 0; i < 5; ++i) a.dot(b, c);
+}
+
+int main(int argc, char** argv) {
+  std::string path = argc > 1 ? argv[1] : tuning::defaultPath();
+
+  tuning::set(tuning::Config{});
+  benchmark_dot("[defaults]", 256);
+  benchmark_dot("[defaults]", 1024);
+
+  tuning::Config tuned = tuning::autotune(true);
+  tuning::set(tuned);
+  benchmark_dot("[tuned]", 256);
+  benchmark_dot("[tuned]", 1024);
+
+  if (!tuning::save(tuned, path)) {
+    std::cerr << "Could not write " << path << std::endl;
+    return 1;
+  }
+  std::cout << "Tuning written to " << path << std::endl;
+  return 0;
+}
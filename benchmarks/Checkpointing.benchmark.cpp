@@ -0,0 +1,53 @@
+#include <iostream>
+#include <string>
+
+#include "talawa/core/Parallel.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+#include "talawa/utils/Timer.hpp"
+
+// Gradient checkpointing on a deep conv stack: activation arena and step
+// time for each segment size, to pick the trade-off for a given batch.
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+constexpr int DEPTH = 16;
+
+std::unique_ptr<NeuralNetwork> make_stack(size_t segment_layers) {
+  auto builder = NeuralNetworkBuilder::create({3, 32, 32});
+  for (int i = 0; i < DEPTH; ++i) {
+    builder.add(Conv2DLayerConfig{
+        .filters = 16, .kernel_size = 3, .padding = 1});
+  }
+  return builder.add(Pooling2DLayerConfig{})
+      .add(DenseLayerConfig{.neurons = 10, .act = Activation::LINEAR})
+      .setCheckpointing(segment_layers)
+      .build(0.01f);
+}
+
+void benchmark_segments(size_t batch, size_t segment_layers) {
+  Matrix X = Matrix::random(batch, 3 * 32 * 32);
+  Matrix Y = Matrix::random(batch, 10);
+
+  auto net = make_stack(segment_layers);
+  net->train(X, Y);  // Plans the step and warms up the pool
+  const ActivationPlan* plan = net->activationPlan();
+  std::cout << "segments of " << segment_layers << ": arena "
+            << plan->arenaBytes() / (1 << 20) << " MB (unshared "
+            << plan->unsharedBytes() / (1 << 20) << " MB), "
+            << plan->recomputedLayers() << " layer forwards recomputed"
+            << std::endl;
+
+  std::string label = "[segments of " + std::to_string(segment_layers) +
+                      "] batch " + std::to_string(batch) + ", 5 steps";
+  {
+    MEASURE_SCOPE(label);
+    for (int i = 0; i < 5; ++i) net->train(X, Y);
+  }
+}
+
+int main() {
+  std::cout << "Thread budget: " << parallel::threadBudget() << std::endl;
+  for (size_t segment : {0, 2, 4, 6, 9}) benchmark_segments(32, segment);
+  return 0;
+}
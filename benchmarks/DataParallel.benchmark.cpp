@@ -0,0 +1,53 @@
+#include "talawa/neuralnetwork/DataParallelTrainer.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "talawa/core/Parallel.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+#include "talawa/utils/Timer.hpp"
+
+// Serial train() vs DataParallelTrainer on a small MNIST-style CNN, at the
+// batch sizes we train with. Speed-up tracks the thread budget.
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+std::unique_ptr<NeuralNetwork> make_cnn() {
+  return NeuralNetworkBuilder::create({1, 28, 28})
+      .add(Conv2DLayerConfig{.filters = 8, .kernel_size = 3, .padding = 1})
+      .add(Pooling2DLayerConfig{.type = PoolingType::MAX})
+      .add(DenseLayerConfig{.neurons = 64})
+      .add(DenseLayerConfig{.neurons = 10, .act = Activation::LINEAR})
+      .setOptimizer(std::make_unique<Adam>())
+      .setLossFunction(std::make_unique<loss::CrossEntropyLoss>())
+      .build(0.001f);
+}
+
+void benchmark_batch(size_t batch) {
+  Matrix X = Matrix::random(batch, 28 * 28);
+  Matrix Y = Matrix::random(batch, 10);
+  std::string label = "batch " + std::to_string(batch) + ", 10 steps";
+
+  auto serial = make_cnn();
+  serial->train(X, Y);  // Warm up caches and the pool
+  {
+    MEASURE_SCOPE("[serial] " + label);
+    for (int i = 0; i < 10; ++i) serial->train(X, Y);
+  }
+
+  auto net = make_cnn();
+  DataParallelTrainer trainer(*net);
+  trainer.train(X, Y);
+  {
+    MEASURE_SCOPE("[" + std::to_string(trainer.replicaCount()) +
+                  " replicas] " + label);
+    for (int i = 0; i < 10; ++i) trainer.train(X, Y);
+  }
+}
+
+int main() {
+  std::cout << "Thread budget: " << parallel::threadBudget() << std::endl;
+  for (size_t batch : {64, 256}) benchmark_batch(batch);
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include <iostream>
+#include <string>
+
+#include "talawa/core/Parallel.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+#include "talawa/utils/Timer.hpp"
+
+// Full-step vs per-layer optimizer updates on an MLP whose parameters (and
+// Adam state) are far larger than the cache: per-layer updates step each
+// layer while its gradient is still cached.
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+std::unique_ptr<NeuralNetwork> make_mlp() {
+  return NeuralNetworkBuilder::create({1, 1, 784})
+      .add(DenseLayerConfig{.neurons = 1024, .act = Activation::RELU})
+      .add(DenseLayerConfig{.neurons = 1024, .act = Activation::RELU})
+      .add(DenseLayerConfig{.neurons = 1024, .act = Activation::RELU})
+      .add(DenseLayerConfig{.neurons = 10, .act = Activation::LINEAR})
+      .setOptimizer(std::make_unique<Adam>())
+      .setLossFunction(std::make_unique<loss::CrossEntropyLoss>())
+      .build(0.001f);
+}
+
+void benchmark_batch(size_t batch, bool per_layer) {
+  Matrix X = Matrix::random(batch, 784);
+  Matrix Y = Matrix::random(batch, 10);
+  std::string label = std::string(per_layer ? "[per-layer]" : "[full step]") +
+                      " batch " + std::to_string(batch) + ", 10 steps";
+
+  auto net = make_mlp();
+  net->setPerLayerUpdates(per_layer);
+  net->train(X, Y);  // Warm up caches, the pool and the Adam state
+  {
+    MEASURE_SCOPE(label);
+    for (int i = 0; i < 10; ++i) net->train(X, Y);
+  }
+}
+
+int main() {
+  std::cout << "Thread budget: " << parallel::threadBudget() << std::endl;
+  for (size_t batch : {16, 64}) {
+    benchmark_batch(batch, false);
+    benchmark_batch(batch, true);
+  }
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include <iostream>
+#include <string>
+
+#include "talawa/core/Parallel.hpp"
+#include "talawa/neuralnetwork/Pooling2DLayer.hpp"
+#include "talawa/utils/Timer.hpp"
+
+// Max and average pooling, forward (inference), forward + backward, in
+// both layouts, for typical windows: 2x2/2 and overlapping 3x3/2.
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+constexpr size_t BATCH = 32;
+constexpr int REPEATS = 20;
+
+void benchmark_pool(int depth, int size, int window, int stride,
+                    PoolingType type, Layout layout) {
+  std::string name = std::to_string(size) + "x" + std::to_string(size) +
+                     "x" + std::to_string(depth) + " " +
+                     (type == PoolingType::MAX ? "max " : "avg ") +
+                     std::to_string(window) + "/" + std::to_string(stride) +
+                     (layout == Layout::NHWC ? " NHWC" : " NCHW");
+  Pooling2DLayer layer(depth, size, size, type, window, stride, layout);
+  Shape out = layer.getOutputShape();
+  Matrix X = Matrix::random(BATCH, depth * size * size);
+  Matrix dY = Matrix::random(BATCH, out.flat());
+
+  layer.forward(X);  // Warm-up
+  layer.backward(dY);
+  {
+    MEASURE_SCOPE("[" + name + "] inference");
+    for (int i = 0; i < REPEATS; ++i) layer.forward(X, false);
+  }
+  {
+    MEASURE_SCOPE("[" + name + "] forward + backward");
+    for (int i = 0; i < REPEATS; ++i) {
+      layer.forward(X);
+      layer.backward(dY);
+    }
+  }
+}
+
+int main() {
+  std::cout << "Thread budget: " << parallel::threadBudget() << std::endl;
+  for (Layout layout : {Layout::NCHW, Layout::NHWC}) {
+    for (PoolingType type : {PoolingType::MAX, PoolingType::AVERAGE}) {
+      benchmark_pool(32, 32, 2, 2, type, layout);
+      benchmark_pool(64, 16, 3, 2, type, layout);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <string>
+
+#include "talawa/core/Parallel.hpp"
+#include "talawa/neuralnetwork/Conv2DLayer.hpp"
+#include "talawa/neuralnetwork/DepthwiseConv2DLayer.hpp"
+#include "talawa/utils/Timer.hpp"
+
+// A full 3x3 convolution against its depthwise-separable replacement
+// (depthwise 3x3 + pointwise 1x1): parameters, inference and a full
+// training step, NHWC, for a few typical shapes.
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+constexpr size_t BATCH = 32;
+constexpr int REPEATS = 5;
+
+size_t parameter_count(ILayer& layer) {
+  size_t total = 0;
+  for (Matrix* p : layer.getParameters()) total += p->size();
+  return total;
+}
+
+void benchmark_layer(int depth, int size, int filters) {
+  std::string shape = std::to_string(size) + "x" + std::to_string(size) +
+                      "x" + std::to_string(depth) + " -> " +
+                      std::to_string(filters);
+  Matrix X = Matrix::random(BATCH, depth * size * size);
+  Matrix dY = Matrix::random(BATCH, filters * size * size);
+
+  Conv2DLayer full(depth, size, size, filters, 3, 1, 1,
+                   Initializer::GLOROT_UNIFORM, Activation::RELU,
+                   Layout::NHWC);
+  DepthwiseConv2DLayer depthwise(depth, size, size, 3, 1, 1,
+                                 Initializer::GLOROT_UNIFORM,
+                                 Activation::RELU, Layout::NHWC);
+  Conv2DLayer pointwise(depth, size, size, filters, 1, 1, 0,
+                        Initializer::GLOROT_UNIFORM, Activation::RELU,
+                        Layout::NHWC);
+  std::cout << "[" << shape << "] parameters: full " << parameter_count(full)
+            << ", separable "
+            << parameter_count(depthwise) + parameter_count(pointwise)
+            << std::endl;
+
+  full.forward(X);  // Warm-up
+  full.backward(dY);
+  {
+    MEASURE_SCOPE("[" + shape + "] full inference");
+    for (int i = 0; i < REPEATS; ++i) full.forward(X, false);
+  }
+  {
+    MEASURE_SCOPE("[" + shape + "] full forward + backward");
+    for (int i = 0; i < REPEATS; ++i) {
+      full.forward(X);
+      full.backward(dY);
+    }
+  }
+
+  pointwise.forward(depthwise.forward(X));  // Warm-up
+  depthwise.backward(pointwise.backward(dY));
+  {
+    MEASURE_SCOPE("[" + shape + "] separable inference");
+    for (int i = 0; i < REPEATS; ++i) {
+      pointwise.forward(depthwise.forward(X, false), false);
+    }
+  }
+  {
+    MEASURE_SCOPE("[" + shape + "] separable forward + backward");
+    for (int i = 0; i < REPEATS; ++i) {
+      pointwise.forward(depthwise.forward(X));
+      depthwise.backward(pointwise.backward(dY));
+    }
+  }
+}
+
+int main() {
+  std::cout << "Thread budget: " << parallel::threadBudget() << std::endl;
+  benchmark_layer(16, 32, 32);
+  benchmark_layer(32, 32, 64);
+  benchmark_layer(64, 16, 128);
+  benchmark_layer(128, 8, 256);
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include <iostream>
+#include <string>
+
+#include "talawa/core/Parallel.hpp"
+#include "talawa/neuralnetwork/Conv2DLayer.hpp"
+#include "talawa/utils/Timer.hpp"
+
+// Winograd against the implicit GEMM on 3x3 stride-1 layers: forward
+// (inference) and a full training step, for a few typical shapes.
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+constexpr size_t BATCH = 32;
+constexpr int REPEATS = 5;
+
+void benchmark_layer(int depth, int size, int filters) {
+  std::string shape = std::to_string(size) + "x" + std::to_string(size) +
+                      "x" + std::to_string(depth) + " -> " +
+                      std::to_string(filters);
+  Matrix X = Matrix::random(BATCH, depth * size * size);
+
+  for (auto algorithm : {ConvAlgorithm::GEMM, ConvAlgorithm::WINOGRAD}) {
+    Conv2DLayer layer(depth, size, size, filters, 3, 1, 1,
+                      Initializer::GLOROT_UNIFORM, Activation::RELU,
+                      Layout::NCHW, algorithm);
+    std::string tile = std::to_string(layer.winogradTile());
+    std::string name =
+        layer.winogradTile() > 0 ? "winograd F(" + tile + "x" + tile + ")"
+                                 : "gemm";
+    Matrix dY = Matrix::random(BATCH, filters * size * size);
+    layer.forward(X);  // Warm-up
+    layer.backward(dY);
+    {
+      MEASURE_SCOPE("[" + shape + "] " + name + " inference");
+      for (int i = 0; i < REPEATS; ++i) layer.forward(X, false);
+    }
+    {
+      MEASURE_SCOPE("[" + shape + "] " + name + " forward + backward");
+      for (int i = 0; i < REPEATS; ++i) {
+        layer.forward(X);
+        layer.backward(dY);
+      }
+    }
+  }
+}
+
+int main() {
+  std::cout << "Thread budget: " << parallel::threadBudget() << std::endl;
+  benchmark_layer(1, 28, 32);
+  benchmark_layer(16, 32, 16);
+  benchmark_layer(32, 32, 32);
+  benchmark_layer(64, 16, 64);
+  benchmark_layer(128, 8, 128);
+  return 0;
+}
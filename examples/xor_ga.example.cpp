@@ -44,7 +44,7 @@ class FitnessStrategy : public talawa::evo::INeuralGenomeFitnessStrategy {
     double fitness = 0.0;
     Matrix outputs = neural_ind.predict(inputs);
 
-    auto error = outputs - expected.transpose();
+    Matrix error = outputs - expected.transpose();
     float se = error.reduce<float>(
         [](float acc, int row, int col, float val) { return acc + val * val; },
         0.0f);
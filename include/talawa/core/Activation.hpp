@@ -21,12 +21,32 @@ class Activation {
 
   // Forward Pass: Returns A = f(Z)
   Matrix apply(const Matrix& z) const;
+  // Same, overwriting z
+  void applyInPlace(const MatrixView& z) const;
+
+  // Softmax normalises whole rows; everything else maps element by element
+  bool isElementwise() const { return type != SOFTMAX && type != LOG_SOFTMAX; }
+
+  // GEMM epilogue adding 'bias' (1 x n) and, for element-wise activations,
+  // applying f to each output tile. Others need applyInPlace afterwards.
+  gemm::Epilogue epilogue(const float* bias) const;
+
+  // Fused layer forward: out = f(x . w + bias), bias being (1 x w.cols).
+  // Element-wise activations run in the GEMM epilogue while each output
+  // tile is still in cache, so out is written once. If z is given it also
+  // receives x . w + bias.
+  void applyAffine(const ConstMatrixView& x, const ConstMatrixView& w,
+                   const Matrix& bias, Matrix& out, Matrix* z = nullptr) const;
 
   // Backward Pass: Returns f'(Z)
   Matrix derivative(const Matrix& z) const;
 
   void backprop(const Matrix& a, const Matrix& outputGradients,
                 Matrix& dZ) const;
+  // Same on contiguous views; dZ must already have a's shape
+  void backprop(const ConstMatrixView& a,
+                const ConstMatrixView& outputGradients,
+                const MatrixView& dZ) const;
   // Utility
   std::string getName() const;
 
@@ -0,0 +1,206 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace talawa {
+namespace core {
+namespace memory {
+
+// Every buffer handed out by an allocator starts on a cache line, so full
+// SIMD registers (up to AVX-512) never straddle two lines.
+constexpr size_t ALIGNMENT = 64;
+
+// --- Base Allocator Interface ---
+class IAllocator {
+ public:
+  virtual ~IAllocator() = default;
+
+  // Returns ALIGNMENT-aligned storage for at least 'count' floats.
+  // 'capacity' receives the number of floats actually reserved.
+  virtual float* allocate(size_t count, size_t& capacity) = 0;
+  // 'capacity' must be the value returned by allocate()
+  virtual void deallocate(float* ptr, size_t capacity) = 0;
+
+  virtual std::string getName() const = 0;
+};
+
+// --- Plain cache-line aligned heap allocation ---
+class AlignedAllocator : public IAllocator {
+ public:
+  float* allocate(size_t count, size_t& capacity) override;
+  void deallocate(float* ptr, size_t capacity) override;
+  std::string getName() const override { return "Aligned"; }
+};
+
+// --- Size-class caching allocator ---
+// Requests are rounded up to a power-of-two size class. Freed buffers are
+// kept on a per-class free list and handed back to the next request of the
+// same class, so the steady-state create/destroy churn of temporaries never
+// reaches malloc/free.
+class PoolAllocator : public IAllocator {
+ public:
+  struct Stats {
+    size_t hits = 0;          // Requests served from a free list
+    size_t misses = 0;        // Requests that went to the system heap
+    size_t bytes_held = 0;    // Idle bytes cached on free lists
+    size_t bytes_in_use = 0;  // Bytes currently owned by live buffers
+  };
+
+  // Buffers above this size bypass the pool (they are rare and huge)
+  static constexpr size_t MAX_POOLED_BYTES = size_t(1) << 28;  // 256 MB
+
+  explicit PoolAllocator(size_t max_cached_bytes = size_t(1) << 30);
+  ~PoolAllocator() override;
+
+  float* allocate(size_t count, size_t& capacity) override;
+  void deallocate(float* ptr, size_t capacity) override;
+  std::string getName() const override { return "Pool"; }
+
+  Stats stats() const;
+  void resetStats();
+  // Returns every cached buffer to the system heap
+  void release();
+  void setMaxCachedBytes(size_t bytes) { max_cached_bytes_ = bytes; }
+
+ private:
+  static constexpr int NUM_CLASSES = 23;  // 64 B ... 256 MB
+  static int sizeClass(size_t bytes);
+
+  struct FreeList {
+    std::mutex lock;
+    std::vector<float*> buffers;
+  };
+  FreeList classes_[NUM_CLASSES];
+
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+  std::atomic<size_t> bytes_held_{0};
+  std::atomic<size_t> bytes_in_use_{0};
+  std::atomic<size_t> max_cached_bytes_;
+};
+
+// The allocator used by every new Matrix buffer (a process-wide
+// PoolAllocator unless replaced). Buffers remember the allocator that
+// created them, so swapping the default never mismatches a free.
+IAllocator& defaultAllocator();
+void setDefaultAllocator(IAllocator* allocator);  // nullptr restores the pool
+PoolAllocator& pool();
+
+// --- Owning, aligned float storage used by core::Matrix ---
+// A minimal vector-like container whose memory comes from an IAllocator.
+class AlignedBuffer {
+ public:
+  AlignedBuffer() = default;
+  explicit AlignedBuffer(size_t count, float value = 0.0f) {
+    resize(count, value);
+  }
+  AlignedBuffer(const AlignedBuffer& other) {
+    reserveExact(other.size_);
+    size_ = other.size_;
+    if (size_) std::memcpy(ptr_, other.ptr_, size_ * sizeof(float));
+  }
+  AlignedBuffer(AlignedBuffer&& other) noexcept { swap(other); }
+  AlignedBuffer& operator=(const AlignedBuffer& other) {
+    if (this != &other) {
+      if (other.size_ > capacity_) {
+        AlignedBuffer tmp(other);
+        swap(tmp);
+      } else {
+        size_ = other.size_;
+        if (size_) std::memcpy(ptr_, other.ptr_, size_ * sizeof(float));
+      }
+    }
+    return *this;
+  }
+  AlignedBuffer& operator=(AlignedBuffer&& other) noexcept {
+    if (this != &other) {
+      AlignedBuffer tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+  ~AlignedBuffer() {
+    if (ptr_ && allocator_) allocator_->deallocate(ptr_, capacity_);
+  }
+
+  // Grows or shrinks to 'count'; new elements are set to 'value'
+  void resize(size_t count, float value = 0.0f) {
+    if (count > capacity_) {
+      AlignedBuffer grown;
+      grown.reserveExact(count);
+      if (size_) std::memcpy(grown.ptr_, ptr_, size_ * sizeof(float));
+      grown.size_ = size_;
+      swap(grown);
+    }
+    if (count > size_) std::fill(ptr_ + size_, ptr_ + count, value);
+    size_ = count;
+  }
+  // Like resize(), but the contents afterwards are unspecified: for buffers
+  // that are about to be overwritten in full
+  void resizeForOverwrite(size_t count) {
+    if (count > capacity_) {
+      AlignedBuffer grown;
+      grown.reserveExact(count);
+      swap(grown);
+    }
+    size_ = count;
+  }
+  void assign(size_t count, float value) {
+    size_ = 0;
+    resize(count, value);
+  }
+  void clear() { size_ = 0; }
+
+  // Releases the owned storage and uses 'count' caller-owned floats at
+  // 'ptr' instead (contents kept as they are there). They are never freed
+  // here; growing past 'count' moves back to owned storage.
+  void borrow(float* ptr, size_t count) {
+    AlignedBuffer released;
+    swap(released);
+    ptr_ = ptr;
+    size_ = capacity_ = count;
+  }
+  bool borrowed() const { return ptr_ && !allocator_; }
+
+  float* data() { return ptr_; }
+  const float* data() const { return ptr_; }
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+
+  float& operator[](size_t i) { return ptr_[i]; }
+  float operator[](size_t i) const { return ptr_[i]; }
+
+  float* begin() { return ptr_; }
+  float* end() { return ptr_ + size_; }
+  const float* begin() const { return ptr_; }
+  const float* end() const { return ptr_ + size_; }
+
+  void swap(AlignedBuffer& other) noexcept {
+    std::swap(ptr_, other.ptr_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(allocator_, other.allocator_);
+  }
+
+ private:
+  // Only valid on an empty buffer
+  void reserveExact(size_t count) {
+    if (count == 0) return;
+    allocator_ = &defaultAllocator();
+    ptr_ = allocator_->allocate(count, capacity_);
+  }
+
+  float* ptr_ = nullptr;
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+  IAllocator* allocator_ = nullptr;  // nullptr: borrowed (or empty)
+};
+
+}  // namespace memory
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+
+namespace talawa {
+namespace core {
+namespace cpu {
+
+// Instruction set tiers we ship kernels for, in increasing order
+enum class SimdLevel { SCALAR = 0, SSE4 = 1, AVX2 = 2, AVX512 = 3 };
+
+// What the CPU *and* the OS support (AVX state must be enabled in XCR0,
+// otherwise the instructions fault even on hardware that has them)
+struct Features {
+  bool sse4_1 = false;
+  bool avx = false;
+  bool avx2 = false;
+  bool fma = false;
+  bool avx512f = false;
+};
+
+// Queried once via cpuid, then cached
+const Features& features();
+
+// Best tier this machine can run
+SimdLevel detectedLevel();
+
+std::string toString(SimdLevel level);
+
+}  // namespace cpu
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,137 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "talawa/core/Allocator.hpp"
+
+namespace talawa {
+namespace core {
+namespace gemm {
+
+// A strided, read-only view of a GEMM operand.
+// Element (i, j) lives at data[i * row_stride + j * col_stride], so the same
+// kernel can read a row-major matrix (row_stride = cols, col_stride = 1) or
+// its transpose (row_stride = 1, col_stride = cols) without copying.
+struct Operand {
+  const float* data;
+  std::ptrdiff_t row_stride;
+  std::ptrdiff_t col_stride;
+};
+
+// An operand whose elements are produced while packing instead of read
+// from memory, e.g. the im2col matrix of a convolution, which then never
+// exists in full. read(row, col, count, dst) writes elements (row, col),
+// ..., (row, col + count - 1) of a row-major source R to dst. The operand
+// is R, or R^T if 'transposed'. Packing calls read() from several threads
+// at once and asks for runs of a packing block, not single elements.
+// Non-owning, so building one never allocates: see gather().
+struct Gathered {
+  using ReadFn = void (*)(const void* ctx, int row, int col, int count,
+                          float* dst);
+  ReadFn read_fn = nullptr;
+  const void* ctx = nullptr;
+  bool transposed = false;
+
+  void read(int row, int col, int count, float* dst) const {
+    read_fn(ctx, row, col, count, dst);
+  }
+};
+
+// Gathers through reader(row, col, count, dst), which is referenced, not
+// copied: it must outlive the Gathered (a temporary passed straight into
+// sgemm does)
+template <typename F>
+Gathered gather(const F& reader, bool transposed = false) {
+  return {[](const void* ctx, int row, int col, int count, float* dst) {
+            (*static_cast<const F*>(ctx))(row, col, count, dst);
+          },
+          &reader, transposed};
+}
+
+// The register tile (MR rows x NR columns of C) depends on the micro-kernel
+// picked for this CPU (see core/Kernels.hpp): 6x32 for AVX-512, 6x16 for
+// AVX2, 6x8 for SSE4 and 4x4 for scalar. These bound all of them.
+constexpr int MAX_MR = 6;
+constexpr int MAX_NR = 32;
+
+// Work folded into the GEMM while each output tile is still in cache,
+// applied to the final value of C once the last K slab is done:
+//   z = C + bias   (stored only if z is set)
+//   C = activation(C + bias)
+// A default-constructed Epilogue does nothing.
+struct Epilogue {
+  const float* bias = nullptr;  // 1 x n row broadcast down every row of C
+  // In-place element-wise function, e.g. kernels::active().relu
+  void (*activation)(float* x, size_t n) = nullptr;
+  float* z = nullptr;  // Optional pre-activation copy, leading dim ldz
+  std::ptrdiff_t ldz = 0;
+
+  bool empty() const {
+    return bias == nullptr && activation == nullptr && z == nullptr;
+  }
+};
+
+// Cache blocking (MC, KC, NC), the thread count and the serial cutoff are
+// host-specific and come from tuning::current() (see core/Tuning.hpp).
+
+/**
+ * @brief C (m x n) = A (m x k) . B (k x n)   [accumulate = false]
+ *        C (m x n) += A (m x k) . B (k x n)  [accumulate = true]
+ *
+ * Packed GEMM (Goto/BLIS style): B is packed into KC x NC panels, A into
+ * MC x KC panels, and an MR x NR micro-kernel keeps the output tile in
+ * registers for the full KC depth.
+ * @param C Row-major output with leading dimension ldc.
+ * @param epilogue Bias/activation fused into the store of each tile, so a
+ * layer's forward pass touches its output once.
+ */
+void sgemm(int m, int n, int k, Operand A, Operand B, float* C,
+           std::ptrdiff_t ldc, bool accumulate = false,
+           const Epilogue& epilogue = {});
+
+// Same, with A and/or B gathered (see Gathered)
+void sgemm(int m, int n, int k, const Gathered& A, Operand B, float* C,
+           std::ptrdiff_t ldc, bool accumulate = false,
+           const Epilogue& epilogue = {});
+void sgemm(int m, int n, int k, Operand A, const Gathered& B, float* C,
+           std::ptrdiff_t ldc, bool accumulate = false,
+           const Epilogue& epilogue = {});
+
+/**
+ * @brief A right-hand operand (k x n) packed once into the panel layout
+ * sgemm uses, for operands reused by many products (e.g. the weights of a
+ * compiled inference plan). Saves re-packing B on every call, which is most
+ * of the work at small batch sizes.
+ * @note The layout depends on the SIMD tier and tuning active when packing.
+ */
+class PackedB {
+ public:
+  PackedB() = default;
+  PackedB(int k, int n, Operand B);
+
+  int rows() const { return k_; }
+  int cols() const { return n_; }
+  int kc() const { return kc_; }
+  int nc() const { return nc_; }
+  int nr() const { return nr_; }
+
+  // Packed (KC x NC) panel starting at row pc, column jc of B
+  const float* panel(int jc, int pc) const;
+
+ private:
+  int k_ = 0, n_ = 0;
+  int kc_ = 0, nc_ = 0, nr_ = 0;
+  std::vector<size_t> offsets_;
+  memory::AlignedBuffer data_;
+};
+
+// C (m x n) (+)= A (m x k) . B, with B pre-packed (k, n from B)
+void sgemm(int m, Operand A, const PackedB& B, float* C, std::ptrdiff_t ldc,
+           bool accumulate = false, const Epilogue& epilogue = {});
+void sgemm(int m, const Gathered& A, const PackedB& B, float* C,
+           std::ptrdiff_t ldc, bool accumulate = false,
+           const Epilogue& epilogue = {});
+
+}  // namespace gemm
+}  // namespace core
+}  // namespace talawa
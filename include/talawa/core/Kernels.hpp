@@ -0,0 +1,167 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "talawa/core/Cpu.hpp"
+
+namespace talawa {
+namespace core {
+namespace kernels {
+
+// Per-step scalars of the fused Adam(W) update, computed once per step so
+// the kernel needs no division:
+//   p = p * decay - step_size * m / (sqrt(v) + epsilon)
+// The bias corrections are folded in: step_size = lr * sqrt(1 - beta2^t) /
+// (1 - beta1^t) and epsilon = eps * sqrt(1 - beta2^t). decay is
+// 1 - lr * weight_decay for AdamW and 1 for Adam.
+struct AdamStep {
+  float beta1;
+  float beta2;
+  float step_size;
+  float epsilon;
+  float decay;
+};
+
+// Elements sharing one scale in adam_update_q8's block-quantised moments
+constexpr size_t Q8_BLOCK = 256;
+
+// One kernel row sliding along one image row of a depthwise convolution.
+// Pixel x holds its channels at x * pixel_stride + c (c < channels), and
+// tap kx of the kernel row its per-channel weights at kx * tap_stride + c.
+// Output pixel ox reads input pixel ox * stride - padding + kx; taps over
+// the padding are skipped. NHWC rows are one call for all channels
+// (pixel_stride = depth), NCHW planes one call per channel (channels = 1).
+struct DepthwiseRow {
+  int channels;
+  std::ptrdiff_t pixel_stride;
+  std::ptrdiff_t tap_stride;
+  int in_width;
+  int out_width;
+  int kernel;
+  int stride;
+  int padding;
+};
+
+// One row of pooling windows: output pixel ox covers input pixels
+// ox * stride + kx, kx < window, of one image row, laid out like a
+// DepthwiseRow (channels at x * pixel_stride + c). Windows never hang over
+// the row.
+struct PoolRow {
+  int channels;
+  std::ptrdiff_t pixel_stride;
+  int out_width;
+  int window;
+  int stride;
+};
+
+/**
+ * @brief One implementation of every SIMD hot loop in the library.
+ * Each instruction set tier (scalar, SSE4, AVX2+FMA, AVX-512) is compiled in
+ * its own translation unit with its own flags (src/core/kernels/), and the
+ * best table the CPU supports is picked at startup. The rest of the library
+ * is built for the baseline ISA and only calls through this table, so one
+ * binary runs everywhere and still uses AVX-512 where it exists.
+ *
+ * All pointers may be unaligned and all lengths may be any size.
+ */
+struct KernelTable {
+  cpu::SimdLevel level;
+  const char* name;
+
+  // --- GEMM ---
+  // Register tile of the micro-kernel: C (mr x nr) (+)= A sliver . B sliver.
+  // A is packed mr-wide and B nr-wide, k-major (see core/Gemm.cpp).
+  int mr;
+  int nr;
+  void (*gemm_micro)(int kc, const float* A, const float* B, float* C,
+                     std::ptrdiff_t ldc, bool accumulate);
+
+  // --- Element-wise ---
+  void (*add)(float* y, const float* x, size_t n);  // y += x
+  void (*scale)(float* y, float s, size_t n);       // y *= s
+  float (*sum)(const float* x, size_t n);
+  float (*dot)(const float* a, const float* b, size_t n);
+
+  // --- Transcendentals ---
+  // Polynomial approximations: max relative error ~2 ulp (exp) and ~4 ulp
+  // (sigmoid, tanh). exp saturates outside [-87.3, 88] instead of returning
+  // inf or denormals.
+  void (*exp)(float* y, const float* x, size_t n);  // y = e^x
+
+  // --- Activations ---
+  void (*relu)(float* x, size_t n);
+  void (*sigmoid)(float* x, size_t n);
+  void (*tanh)(float* x, size_t n);
+  // One row in place: e^(x - max) / sum, clipped to [eps, 1 - eps]
+  void (*softmax)(float* x, size_t n, float eps);
+  // dz = g where a > 0, else 0
+  void (*relu_backward)(float* dz, const float* a, const float* g, size_t n);
+  // dz = a * (1 - a) * g
+  void (*sigmoid_backward)(float* dz, const float* a, const float* g,
+                           size_t n);
+  // dz = (1 - a^2) * g
+  void (*tanh_backward)(float* dz, const float* a, const float* g, size_t n);
+  // dz = y * (g - d): one row of the softmax vector-Jacobian product
+  void (*softmax_backward)(float* dz, const float* y, const float* g, float d,
+                           size_t n);
+
+  // --- Optimizers ---
+  void (*sgd_update)(float* p, const float* g, float lr, size_t n);
+  // velocity = momentum * velocity + g; p -= lr * velocity
+  void (*sgd_momentum_update)(float* p, const float* g, float* velocity,
+                              float lr, float momentum, size_t n);
+  void (*adam_update)(float* p, const float* g, float* m, float* v,
+                      const AdamStep& step, size_t n);
+  // adam_update with low-precision moments (see core::QuantizedAdam). The
+  // moments are widened in registers, updated in float and rounded back
+  // stochastically, seeded by `seed`, so the rounding is unbiased.
+  // bf16: m and v are the upper halves of their floats.
+  void (*adam_update_bf16)(float* p, const float* g, uint16_t* m,
+                           uint16_t* v, const AdamStep& step, uint32_t seed,
+                           size_t n);
+  // 8-bit: per Q8_BLOCK elements, m = m_q * m_scale (m_q in [-127, 127]) and
+  // sqrt(v) = v_q * v_scale (v_q in [0, 255]). n counts elements; the scales
+  // hold one entry per started block.
+  void (*adam_update_q8)(float* p, const float* g, int8_t* m, uint8_t* v,
+                         float* m_scale, float* v_scale, const AdamStep& step,
+                         uint32_t seed, size_t n);
+
+  // --- Depthwise convolution ---
+  // out[ox] += w[kx] * in[ox * stride - padding + kx], per channel
+  void (*depthwise_row)(float* out, const float* in, const float* w,
+                        const DepthwiseRow& row);
+  // The transpose: dx[ox * stride - padding + kx] += w[kx] * dz[ox]
+  void (*depthwise_row_input_grad)(float* dx, const float* dz, const float* w,
+                                   const DepthwiseRow& row);
+  // dw[kx] += sum over ox of dz[ox] * in[ox * stride - padding + kx]
+  void (*depthwise_row_weight_grad)(float* dw, const float* dz,
+                                    const float* in, const DepthwiseRow& row);
+
+  // --- Pooling ---
+  // out[ox] = max(out[ox], in[ox * stride + kx]) over the window. Where a
+  // strictly larger value wins, arg (if not null) gets its position in the
+  // row plus 'first'.
+  void (*pool_max_row)(float* out, int* arg, const float* in, int first,
+                       const PoolRow& row);
+  // out[ox] += scale * in[ox * stride + kx] over the window
+  void (*pool_sum_row)(float* out, const float* in, float scale,
+                       const PoolRow& row);
+  // The transpose: dx[ox * stride + kx] += scale * g[ox]
+  void (*pool_spread_row)(float* dx, const float* g, float scale,
+                          const PoolRow& row);
+};
+
+// The table used by the library (best available unless forced)
+const KernelTable& active();
+
+// Forces a tier (clamped to what the CPU supports). Meant for tests and
+// benchmarks; not safe to call while other threads are running kernels.
+// The TALAWA_SIMD environment variable (scalar|sse4|avx2|avx512) does the
+// same at startup.
+void force(cpu::SimdLevel level);
+// Back to the best available tier
+void reset();
+
+}  // namespace kernels
+}  // namespace core
+}  // namespace talawa
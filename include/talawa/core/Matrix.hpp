@@ -5,7 +5,10 @@
 #include <vector>
 #include <iostream>
 
+#include "talawa/core/Allocator.hpp"
 #include "talawa/core/Error.hpp"
+#include "talawa/core/MatrixExpr.hpp"
+#include "talawa/core/MatrixView.hpp"
 
 namespace talawa {
 namespace core {
@@ -19,17 +22,26 @@ class Matrix {
   Matrix(const Matrix&) = default;
   Matrix(Matrix&&) = default;
   Matrix(float scalar) : Matrix({{scalar}}) {};
+  // Materialises (copies) the elements of a view
+  explicit Matrix(const ConstMatrixView& view);
+  // Evaluates an element-wise expression (see MatrixExpr.hpp) in one pass
+  template <typename E>
+  Matrix(const expr::Expr<E>& expression);
   void print(int decimals = 4) const;
 
   // Operation overloads
-  Matrix operator+(const Matrix& other) const;
-  Matrix operator-(const Matrix& other) const;
-  Matrix operator*(const float scalar) const;
+  // +, - and scalar * are lazy, fused expressions (see MatrixExpr.hpp)
   Matrix& operator=(const Matrix& other);
-  Matrix& operator=(Matrix&&) = default;
+  Matrix& operator=(Matrix&& other) noexcept;
+  template <typename E>
+  Matrix& operator=(const expr::Expr<E>& expression);
   bool operator==(const Matrix& other) const;
 
-  Matrix& operator+=(const Matrix& other);
+  Matrix& operator+=(const ConstMatrixView& other);
+  template <typename E>
+  Matrix& operator+=(const expr::Expr<E>& expression) {
+    return *this = *this + expression.derived();
+  }
 
   // Element access
   float operator()(int row, int col) const;
@@ -47,8 +59,9 @@ class Matrix {
   }
 
   // Dot and hadamard products
-  Matrix dot(const Matrix& other) const;
-  void dot(const Matrix& other, Matrix& out) const;
+  // The right-hand operand may be any view (row range, sub-block, ...)
+  Matrix dot(const ConstMatrixView& other) const;
+  void dot(const ConstMatrixView& other, Matrix& out) const;
 
   template <typename T = float>
   T item() const {
@@ -65,7 +78,19 @@ class Matrix {
   // Result: (n x m)
   Matrix dotWithBTransposed(const Matrix& B_T) const;
   void dotWithBTransposed(const Matrix& B_T, Matrix& out) const;
-  Matrix hadamard(const Matrix& other) const;
+
+  // Transpose-free products: the transposed operand is read in its stored
+  // layout by the GEMM packing step, so no transposed copy is materialised.
+  // dotTN: this^T . B   this: (k x n), B: (k x m) -> (n x m)
+  // dotNT: this . B^T   this: (n x k), B: (m x k) -> (n x m)
+  Matrix dotTN(const ConstMatrixView& B) const;
+  void dotTN(const ConstMatrixView& B, Matrix& out) const;
+  Matrix dotNT(const ConstMatrixView& B) const;
+  void dotNT(const ConstMatrixView& B, Matrix& out) const;
+  // Lazy element-wise product (see MatrixExpr.hpp)
+  auto hadamard(const Matrix& other) const {
+    return core::hadamard(*this, other);
+  }
   Matrix addVector(const Matrix& vector) const;
   void reduceToRow(Matrix& out) const;
   void reduceToCol(Matrix& out) const;
@@ -73,6 +98,16 @@ class Matrix {
   // (exclusive)
   Matrix slice(int start_row, int end_row) const;
 
+  // Zero-copy windows onto this matrix (see MatrixView.hpp).
+  // Views are invalidated by anything that reallocates the matrix.
+  ConstMatrixView view() const { return ConstMatrixView(*this); }
+  MatrixView view() { return MatrixView(*this); }
+  // Same rows as slice(), without the copy
+  ConstMatrixView rowRange(int start_row, int end_row) const;
+  MatrixView rowRange(int start_row, int end_row);
+  // Resizes to the view's shape and copies its elements
+  void assign(const ConstMatrixView& view);
+
   // Other utilities
   Matrix transpose() const;
   void transpose(Matrix& out) const;
@@ -132,14 +167,55 @@ class Matrix {
     return accumulator;
   }
   // Access to raw data for performance-critical operations
+  // Owned buffers start on a 64-byte boundary (see core/Allocator.hpp)
   float* rawData() { return data.data(); }
   const float* rawData() const { return data.data(); }
 
-  std::vector<float> flatten() const { return std::vector<float>(data); }
+  // Copies the elements into caller-owned storage of size() floats and
+  // keeps them there (e.g. a slice of a network's parameter arena). The
+  // storage must outlive the matrix; changing its size detaches it again.
+  void bindStorage(float* storage);
+  bool isBound() const { return data.borrowed(); }
+
+  std::vector<float> flatten() const {
+    return std::vector<float>(data.begin(), data.end());
+  }
 
  private:
-  std::vector<float> data;
+  // Aligned storage recycled through memory::defaultAllocator()
+  memory::AlignedBuffer data;
 };
 
+inline ConstMatrixView::ConstMatrixView(const Matrix& m)
+    : ConstMatrixView(m.rawData(), m.rows, m.cols) {}
+inline MatrixView::MatrixView(Matrix& m)
+    : MatrixView(m.rawData(), m.rows, m.cols) {}
+
+template <typename E>
+Matrix::Matrix(const expr::Expr<E>& expression)
+    : rows(expression.derived().rows), cols(expression.derived().cols) {
+  data.resizeForOverwrite(rows * cols);
+  expr::evaluate(expression.derived(), rows, cols, data.data());
+}
+
+template <typename E>
+Matrix& Matrix::operator=(const expr::Expr<E>& expression) {
+  const E& e = expression.derived();
+  // Evaluate in place unless that would read elements already overwritten
+  // (or the shape changes): then go through a fresh buffer, which the move
+  // copies into bound storage of the same size rather than replacing it
+  if (rows != e.rows || cols != e.cols || e.conflictsWith(rawData(), size())) {
+    Matrix result(e);
+    return *this = std::move(result);
+  }
+  expr::evaluate(e, rows, cols, data.data());
+  return *this;
+}
+
+template <typename Derived>
+Matrix expr::Expr<Derived>::eval() const {
+  return Matrix(derived());
+}
+
 }  // namespace core
 }  // namespace talawa
@@ -0,0 +1,293 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "talawa/core/Error.hpp"
+#include "talawa/core/MatrixView.hpp"
+#include "talawa/core/Parallel.hpp"
+
+namespace talawa {
+namespace core {
+
+class Matrix;  // Defined in Matrix.hpp (which includes this header)
+
+/**
+ * Lazily evaluated element-wise arithmetic.
+ *
+ * `a + b`, `a - b`, `a * s`, `s * a` and `hadamard(a, b)` do not compute
+ * anything: they return small expression objects that record the operation.
+ * The work happens once, when the expression is assigned to (or used to
+ * construct) a Matrix, in a single loop that reads every operand and writes
+ * the result exactly once. So
+ *
+ *   *dst = (*src) * tau + (*dst) * (1.0f - tau);
+ *
+ * is one pass over memory instead of three passes and two temporaries.
+ *
+ * The loop is plain scalar code under `omp simd`, split across the shared
+ * scheduler (core/Parallel.hpp): the compiler vectorises it for whatever
+ * instruction set the including TU targets.
+ *
+ * @note Like any expression template, an expression holds references to
+ * its Matrix operands. Temporaries (e.g. `m.transpose()`) are moved into the
+ * expression, so `auto e = a - b.transpose();` is safe, but `a` must outlive
+ * `e`. Call eval() to get a Matrix.
+ */
+namespace expr {
+
+// Below this many elements per chunk, threads cost more than they save
+constexpr size_t PARALLEL_THRESHOLD = size_t(1) << 15;
+
+template <typename Derived>
+class Expr {
+ public:
+  const Derived& derived() const { return static_cast<const Derived&>(*this); }
+  // Forces evaluation (defined in Matrix.hpp)
+  Matrix eval() const;
+};
+
+// --- Leaves ---
+
+// Reads a Matrix (or any view) that outlives the expression
+class Ref : public Expr<Ref> {
+ public:
+  Ref(const ConstMatrixView& v)
+      : rows(v.rows), cols(v.cols), stride(v.stride), data(v.rawData()) {}
+
+  size_t rows;
+  size_t cols;
+  size_t stride;  // 0 when a single row is broadcast down every row
+
+  float at(size_t i) const { return data[i]; }
+  float at(size_t r, size_t c) const { return data[r * stride + c]; }
+
+  bool isFlat() const { return stride == cols || rows <= 1; }
+  void broadcastRows(size_t n) {
+    rows = n;
+    stride = 0;
+  }
+  // True if writing the result to 'out' while reading this leaf could read
+  // an element after it has been overwritten (reading exactly the element
+  // being written, as in `a = a * 2`, is fine)
+  bool conflictsWith(const float* out, size_t out_size) const {
+    const float* end = data + (rows == 0 ? 0 : (rows - 1) * stride + cols);
+    bool overlaps = data < out + out_size && out < end;
+    return overlaps && !(data == out && stride == cols);
+  }
+
+ protected:
+  const float* data;
+};
+
+// Owns a temporary operand (e.g. the result of transpose()) so that the
+// expression stays valid after the full-expression that created it
+template <typename M>
+struct Owned {
+  M value;
+};
+
+template <typename M>
+class Temp : private Owned<M>, public Ref {
+ public:
+  explicit Temp(M&& m) : Owned<M>{std::move(m)}, Ref(this->value) {}
+  Temp(const Temp& other) : Owned<M>{other.value}, Ref(other) { rebind(); }
+  Temp(Temp&& other) noexcept
+      : Owned<M>{std::move(other.value)}, Ref(other) {
+    rebind();
+  }
+
+  // Nobody else can write to a private copy
+  bool conflictsWith(const float*, size_t) const { return false; }
+
+ private:
+  void rebind() { data = this->value.rawData(); }
+};
+
+// --- Operations ---
+struct Add {
+  static float apply(float a, float b) { return a + b; }
+  static constexpr const char* name = "+";
+  static constexpr bool row_broadcast = true;  // (n x m) + (1 x m)
+};
+struct Sub {
+  static float apply(float a, float b) { return a - b; }
+  static constexpr const char* name = "-";
+  static constexpr bool row_broadcast = false;
+};
+struct Mul {
+  static float apply(float a, float b) { return a * b; }
+  static constexpr const char* name = "Hadamard product";
+  static constexpr bool row_broadcast = false;
+};
+
+template <typename L, typename R, typename Op>
+class Binary : public Expr<Binary<L, R, Op>> {
+ public:
+  Binary(L lhs_, R rhs_) : lhs(std::move(lhs_)), rhs(std::move(rhs_)) {
+    size_t lr = lhs.rows, lc = lhs.cols;
+    size_t rr = rhs.rows, rc = rhs.cols;
+    if (lc == rc && lr != rr && rr == 1 && Op::row_broadcast) {
+      rhs.broadcastRows(lr);
+    } else if (lr != rr || lc != rc) {
+      THROW_talawa_ERROR(Matrix, "Dimension mismatch for "
+                                     << Op::name << " operation: (" << lr
+                                     << "x" << lc << ") " << Op::name << " ("
+                                     << rr << "x" << rc << ")");
+    }
+    rows = lr;
+    cols = lc;
+  }
+
+  size_t rows;
+  size_t cols;
+
+  float at(size_t i) const { return Op::apply(lhs.at(i), rhs.at(i)); }
+  float at(size_t r, size_t c) const {
+    return Op::apply(lhs.at(r, c), rhs.at(r, c));
+  }
+  bool isFlat() const { return lhs.isFlat() && rhs.isFlat(); }
+  void broadcastRows(size_t n) {
+    lhs.broadcastRows(n);
+    rhs.broadcastRows(n);
+    rows = n;
+  }
+  bool conflictsWith(const float* out, size_t out_size) const {
+    return lhs.conflictsWith(out, out_size) || rhs.conflictsWith(out, out_size);
+  }
+
+ private:
+  L lhs;
+  R rhs;
+};
+
+template <typename E>
+class Scaled : public Expr<Scaled<E>> {
+ public:
+  Scaled(E e_, float scalar)
+      : rows(e_.rows), cols(e_.cols), e(std::move(e_)), scalar(scalar) {}
+
+  size_t rows;
+  size_t cols;
+
+  float at(size_t i) const { return e.at(i) * scalar; }
+  float at(size_t r, size_t c) const { return e.at(r, c) * scalar; }
+  bool isFlat() const { return e.isFlat(); }
+  void broadcastRows(size_t n) {
+    e.broadcastRows(n);
+    rows = n;
+  }
+  bool conflictsWith(const float* out, size_t out_size) const {
+    return e.conflictsWith(out, out_size);
+  }
+
+ private:
+  E e;
+  float scalar;
+};
+
+// --- Evaluation ---
+// Writes the (rows x cols) result of 'e' to row-major 'out' in one pass
+template <typename E>
+void evaluate(const E& e, size_t rows, size_t cols, float* out) {
+  const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(rows * cols);
+  const std::ptrdiff_t grain = PARALLEL_THRESHOLD;
+
+  if (e.isFlat()) {
+    // Every operand is contiguous: one flat loop over all elements
+    parallel::parallelFor(0, size, grain, [&](auto begin, auto end) {
+#pragma omp simd
+      for (std::ptrdiff_t i = begin; i < end; ++i) out[i] = e.at(i);
+    });
+    return;
+  }
+
+  // A row is broadcast (or an operand is strided): walk row by row
+  const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(rows);
+  const std::ptrdiff_t row_grain =
+      std::max<std::ptrdiff_t>(1, grain / std::max<std::ptrdiff_t>(1, cols));
+  parallel::parallelFor(0, n, row_grain, [&](auto begin, auto end) {
+    for (std::ptrdiff_t r = begin; r < end; ++r) {
+      float* out_row = out + r * cols;
+#pragma omp simd
+      for (size_t c = 0; c < cols; ++c) out_row[c] = e.at(r, c);
+    }
+  });
+}
+
+// --- Operand plumbing ---
+template <typename T>
+concept IsExpr =
+    std::derived_from<std::remove_cvref_t<T>, Expr<std::remove_cvref_t<T>>>;
+
+template <typename T>
+concept IsMatrixLike = std::same_as<std::remove_cvref_t<T>, Matrix> ||
+                       std::same_as<std::remove_cvref_t<T>, ConstMatrixView> ||
+                       std::same_as<std::remove_cvref_t<T>, MatrixView>;
+
+template <typename T>
+concept Operand = IsExpr<T> || IsMatrixLike<T>;
+
+// lvalue matrices and views are referenced, rvalue matrices are moved in,
+// and sub-expressions are stored by value
+template <Operand T>
+auto wrap(T&& operand) {
+  using Plain = std::remove_cvref_t<T>;
+  if constexpr (IsExpr<T>) {
+    return Plain(std::forward<T>(operand));
+  } else if constexpr (std::same_as<Plain, Matrix> &&
+                       !std::is_lvalue_reference_v<T>) {
+    return Temp<Matrix>(std::move(operand));
+  } else {
+    return Ref(ConstMatrixView(operand));
+  }
+}
+
+template <typename T>
+using Wrapped = decltype(wrap(std::declval<T>()));
+
+// --- Operators ---
+// Declared here so argument-dependent lookup finds them for expression
+// operands, and re-exported into core below for Matrix/view operands
+template <Operand A, Operand B>
+auto operator+(A&& a, B&& b) {
+  return Binary<Wrapped<A>, Wrapped<B>, Add>(wrap(std::forward<A>(a)),
+                                             wrap(std::forward<B>(b)));
+}
+
+template <Operand A, Operand B>
+auto operator-(A&& a, B&& b) {
+  return Binary<Wrapped<A>, Wrapped<B>, Sub>(wrap(std::forward<A>(a)),
+                                             wrap(std::forward<B>(b)));
+}
+
+template <Operand A>
+auto operator*(A&& a, float scalar) {
+  return Scaled<Wrapped<A>>(wrap(std::forward<A>(a)), scalar);
+}
+
+template <Operand A>
+auto operator*(float scalar, A&& a) {
+  return Scaled<Wrapped<A>>(wrap(std::forward<A>(a)), scalar);
+}
+
+// Element-wise product (a.hadamard(b) is the member spelling)
+template <Operand A, Operand B>
+auto hadamard(A&& a, B&& b) {
+  return Binary<Wrapped<A>, Wrapped<B>, Mul>(wrap(std::forward<A>(a)),
+                                             wrap(std::forward<B>(b)));
+}
+
+}  // namespace expr
+
+using expr::hadamard;
+using expr::operator+;
+using expr::operator-;
+using expr::operator*;
+
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,129 @@
+#pragma once
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "talawa/core/Error.hpp"
+#include "talawa/core/Gemm.hpp"
+
+namespace talawa {
+namespace core {
+
+class Matrix;  // Defined in Matrix.hpp (which includes this header)
+class MatrixView;
+
+/**
+ * @brief Non-owning, read-only window onto row-major float storage.
+ * Element (r, c) lives at data[r * stride + c], so a view can describe a
+ * whole Matrix, a contiguous range of rows (stride == cols) or an arbitrary
+ * sub-block (stride > cols) without copying anything.
+ * @note A view never extends the lifetime of what it points into.
+ */
+class ConstMatrixView {
+ public:
+  ConstMatrixView() : rows(0), cols(0), stride(0), data(nullptr) {}
+  ConstMatrixView(const float* data, size_t rows, size_t cols, size_t stride)
+      : rows(rows), cols(cols), stride(stride), data(data) {}
+  ConstMatrixView(const float* data, size_t rows, size_t cols)
+      : ConstMatrixView(data, rows, cols, cols) {}
+  // Implicit, so every API taking a view also accepts a Matrix
+  ConstMatrixView(const Matrix& m);
+
+  size_t rows;
+  size_t cols;
+  size_t stride;  // Distance (in floats) between the starts of two rows
+
+  size_t size() const { return rows * cols; }
+  bool isContiguous() const { return stride == cols || rows <= 1; }
+
+  const float* rawData() const { return data; }
+  const float* row(size_t r) const { return data + r * stride; }
+
+  float operator()(int row, int col) const {
+    if (row < 0 || row >= static_cast<int>(rows) || col < 0 ||
+        col >= static_cast<int>(cols)) {
+      THROW_talawa_ERROR(MatrixView, "View indices out of bounds: (" +
+                                         std::to_string(row) + ", " +
+                                         std::to_string(col) + ")");
+    }
+    return data[row * stride + col];
+  }
+
+  // Rows [start_row, end_row) of this view
+  ConstMatrixView rowRange(size_t start_row, size_t end_row) const;
+  // (num_rows x num_cols) block whose top-left corner is (row, col)
+  ConstMatrixView block(size_t row, size_t col, size_t num_rows,
+                        size_t num_cols) const;
+
+  // GEMM on views. 'out' must already have the result shape.
+  // dot:   out = this . B
+  // dotTN: out = this^T . B
+  // dotNT: out = this . B^T
+  // dot can also fuse a bias/activation epilogue (see core/Gemm.hpp).
+  void dot(const ConstMatrixView& B, const MatrixView& out,
+           const gemm::Epilogue& epilogue = {}) const;
+  void dotTN(const ConstMatrixView& B, const MatrixView& out) const;
+  void dotNT(const ConstMatrixView& B, const MatrixView& out) const;
+
+  // Adds every row into out (1 x cols)
+  void reduceToRow(const MatrixView& out) const;
+
+ private:
+  const float* data;
+};
+
+/**
+ * @brief Non-owning, writable window onto row-major float storage.
+ * Copying a MatrixView copies the window, not the elements.
+ */
+class MatrixView {
+ public:
+  MatrixView() : rows(0), cols(0), stride(0), data(nullptr) {}
+  MatrixView(float* data, size_t rows, size_t cols, size_t stride)
+      : rows(rows), cols(cols), stride(stride), data(data) {}
+  MatrixView(float* data, size_t rows, size_t cols)
+      : MatrixView(data, rows, cols, cols) {}
+  MatrixView(Matrix& m);
+
+  operator ConstMatrixView() const {
+    return ConstMatrixView(data, rows, cols, stride);
+  }
+
+  size_t rows;
+  size_t cols;
+  size_t stride;
+
+  size_t size() const { return rows * cols; }
+  bool isContiguous() const { return stride == cols || rows <= 1; }
+
+  float* rawData() const { return data; }
+  float* row(size_t r) const { return data + r * stride; }
+
+  float& operator()(int row, int col) const {
+    if (row < 0 || row >= static_cast<int>(rows) || col < 0 ||
+        col >= static_cast<int>(cols)) {
+      THROW_talawa_ERROR(MatrixView, "View indices out of bounds: (" +
+                                         std::to_string(row) + ", " +
+                                         std::to_string(col) + ")");
+    }
+    return data[row * stride + col];
+  }
+
+  MatrixView rowRange(size_t start_row, size_t end_row) const;
+  MatrixView block(size_t row, size_t col, size_t num_rows,
+                   size_t num_cols) const;
+
+  // Element-wise helpers that honour the row stride
+  void fill(float value) const;
+  void copyFrom(const ConstMatrixView& src) const;
+  // Same shape, or a (1 x cols) row broadcast down every row
+  const MatrixView& operator+=(const ConstMatrixView& other) const;
+  const MatrixView& operator*=(float scalar) const;
+
+ private:
+  float* data;
+};
+
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace talawa {
+namespace core {
+namespace parallel {
+
+/**
+ * @brief Library-wide work-stealing scheduler.
+ * Every parallel loop in the library (GEMM, element-wise kernels, layers,
+ * arena rollouts, population fitness) runs on one shared pool, so nested
+ * parallelism composes instead of oversubscribing: a GEMM inside a parallel
+ * rollout pushes its blocks onto the calling worker's deque, and only idle
+ * workers steal them.
+ *
+ * The thread budget (caller included) defaults to tuning::current().threads()
+ * and can be changed at any time; extra workers are only spawned, never
+ * destroyed, and workers beyond the budget stay asleep.
+ */
+
+// Total threads (including the calling thread) the library may use
+int threadBudget();
+// 0 = follow the tuning config again
+void setThreadBudget(int threads);
+
+// True while running inside a parallelFor body
+bool inParallel();
+
+namespace detail {
+using ChunkFn = void (*)(void* ctx, std::ptrdiff_t begin, std::ptrdiff_t end);
+void run(std::ptrdiff_t begin, std::ptrdiff_t end, std::ptrdiff_t grain,
+         ChunkFn fn, void* ctx);
+}  // namespace detail
+
+/**
+ * @brief Calls body(chunk_begin, chunk_end) over [begin, end) split into
+ * chunks of at least `grain` items, on up to threadBudget() threads.
+ * The caller works on its own loop too and returns when every chunk is
+ * done. The first exception thrown by a chunk is rethrown here.
+ * Ranges of at most `grain` items (or a budget of 1) run inline.
+ */
+template <typename F>
+void parallelFor(std::ptrdiff_t begin, std::ptrdiff_t end, std::ptrdiff_t grain,
+                 F&& body) {
+  using Body = std::remove_reference_t<F>;
+  detail::run(
+      begin, end, grain,
+      [](void* ctx, std::ptrdiff_t lo, std::ptrdiff_t hi) {
+        (*static_cast<Body*>(ctx))(lo, hi);
+      },
+      const_cast<void*>(static_cast<const void*>(&body)));
+}
+
+}  // namespace parallel
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,67 @@
+#pragma once
+#include <optional>
+#include <string>
+
+namespace talawa {
+namespace core {
+namespace tuning {
+
+/**
+ * @brief Host-specific performance knobs for the Matrix kernels.
+ * The defaults suit a typical desktop. `autotune()` measures better values
+ * for this machine and `save()` writes them to a tuning file, which
+ * `current()` loads at startup so later runs reuse them.
+ */
+struct Config {
+  // GEMM cache blocking (see core/Gemm.hpp):
+  // - A panels are mc x kc (sized for L2)
+  // - B panels are kc x nc (shared by every thread, sized for L3)
+  // mc and nc are rounded to the active micro-kernel's tile at run time.
+  int mc = 120;
+  int kc = 256;
+  int nc = 4096;
+
+  // GEMM problems below this many multiply-adds (m * n * k) run serially
+  long long gemm_parallel_ops = 10'000;
+
+  // Thread cap for the library's kernels (0 = all hardware threads but two)
+  int max_threads = 0;
+
+  // Square tile used by Matrix::transpose, and the element count below
+  // which a transpose stays on one thread
+  int transpose_block = 32;
+  long long transpose_parallel_elems = 1 << 14;
+
+  // max_threads resolved against this machine (always >= 1)
+  int threads() const;
+};
+
+// Active configuration. On first use this loads the tuning file (see
+// defaultPath()) if one exists for this host; with TALAWA_AUTOTUNE=1 and
+// no file, it autotunes and writes one.
+const Config& current();
+
+// Replaces the active configuration (values are clamped to sane ranges).
+// Not safe to call while other threads are running kernels.
+void set(const Config& config);
+
+// $TALAWA_TUNING_FILE, else $XDG_CACHE_HOME/talawa/tuning.yaml, else
+// ~/.cache/talawa/tuning.yaml
+std::string defaultPath();
+
+// Tuning files record the host they were measured on (SIMD tier and
+// thread count); load() ignores files from a different host.
+bool save(const Config& config, const std::string& path = defaultPath());
+std::optional<Config> load(const std::string& path = defaultPath());
+
+/**
+ * @brief Benchmarks candidate blockings, thread counts and serial/parallel
+ * cutoffs on representative shapes and returns the fastest configuration.
+ * Takes a few seconds. The active configuration is left untouched.
+ * @param verbose Print each measurement to stdout.
+ */
+Config autotune(bool verbose = false);
+
+}  // namespace tuning
+}  // namespace core
+}  // namespace talawa
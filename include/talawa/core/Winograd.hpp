@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "talawa/core/Gemm.hpp"
+
+namespace talawa {
+namespace core {
+namespace winograd {
+
+// Winograd F(m x m, 3 x 3): a 3x3, stride-1 convolution computed on
+// (m + 2) x (m + 2) input tiles that each give m x m outputs. Inputs and
+// filters are transformed so that the convolution becomes (m + 2)^2
+// independent GEMMs (tiles x channels) . (channels x filters), one per
+// point of the transformed tile, and the products are transformed back:
+//   Y = A^T [ (G g G^T) * (B^T d B) ] A
+// That is 4 (m = 2) or 2.25 (m = 4) multiplies per output instead of 9.
+// m = 4 is the cheaper of the two but rounds a little more.
+
+// Element (b, c, y, x) of a batch of images lives at
+// data[b * image_stride + c * channel_stride + (y * width + x) *
+// pixel_stride], so NCHW rows, NHWC rows and pixel-major GEMM outputs can
+// all be read in place.
+struct Image {
+  const float* data;
+  int batch, channels, height, width;
+  std::ptrdiff_t image_stride, channel_stride, pixel_stride;
+};
+
+// Weight (ky, kx, in, out) lives at data[ky * y + kx * x + in * c_in +
+// out * c_out]. Negative strides read flipped kernels.
+struct Weights {
+  const float* data;
+  std::ptrdiff_t y, x, c_in, c_out;
+};
+
+// The output tile edge (2 or 4) needing the fewest multiplies for an
+// output of this size; ties go to the more accurate m = 2
+int pickTile(int out_height, int out_width);
+
+// Transformed filters G g G^T, packed as one GEMM operand per point
+class Filters {
+ public:
+  Filters() = default;
+  Filters(int tile, int channels, int filters, const Weights& weights);
+
+  int tile() const { return tile_; }
+  int channels() const { return channels_; }
+  int filters() const { return filters_; }
+  const gemm::PackedB& point(int i) const { return points_[i]; }
+
+ private:
+  int tile_ = 0, channels_ = 0, filters_ = 0;
+  std::vector<gemm::PackedB> points_;
+};
+
+/**
+ * @brief Zero-padded 3x3, stride-1 convolution of 'input' with 'filters'.
+ * @param out Pixel-major output: row (b * OH + y) * OW + x holds the
+ * filters of output pixel (y, x) of image b, leading dimension ldo, where
+ * OH = height + 2 * padding - 2 and OW likewise.
+ * @param epilogue Bias and element-wise activation applied to each output
+ * row as it is written (the pre-activation copy 'z' is not supported).
+ */
+void conv3x3(const Image& input, int padding, const Filters& filters,
+             float* out, std::ptrdiff_t ldo, const gemm::Epilogue& epilogue);
+
+}  // namespace winograd
+}  // namespace core
+}  // namespace talawa
@@ -22,18 +22,9 @@ class NeuralGenome : public Genome<NeuralGenomeGeneType> {
     return *this;
   }
   NeuralGenome(const NeuralNetwork& nn) : brain(nn) {
-    // Extract weights and biases from the neural network into genes
-    _genes.clear();
-    for (const auto& layer : brain.layers) {
-      auto params = layer->getParameters();
-      for (const auto& param : params) {
-        for (size_t i = 0; i < param->rows; ++i) {
-          for (size_t j = 0; j < param->cols; ++j) {
-            _genes.push_back((*param)(i, j));
-          }
-        }
-      }
-    }
+    // The genes are the brain's parameter arena, copied in one go
+    const float* params = brain.parameterData();
+    _genes.assign(params, params + brain.getTotalParameters());
   }
   NeuralGenome(const NeuralGenome& other) : brain(other.brain) {
     this->_genes = other._genes;
@@ -44,25 +35,14 @@ class NeuralGenome : public Genome<NeuralGenomeGeneType> {
 
   void setFitness(float fit) override { fitness = fit; }
   void setGenes(const NeuralGenomeGeneType& new_genes) {
-    size_t gene_index = 0;
-    for (auto& layer : brain.layers) {
-      auto params = layer->getParameters();
-      for (auto& param : params) {
-        for (size_t i = 0; i < param->rows; ++i) {
-          for (size_t j = 0; j < param->cols; ++j) {
-            if (gene_index < new_genes.size()) {
-              (*param)(i, j) = new_genes[gene_index++];
-            } else {
-              throw std::runtime_error(
-                  "Not enough genes to set all parameters.");
-            }
-          }
-        }
-      }
+    size_t count = static_cast<size_t>(brain.getTotalParameters());
+    if (new_genes.size() < count) {
+      throw std::runtime_error("Not enough genes to set all parameters.");
     }
-    if (gene_index != new_genes.size()) {
+    if (new_genes.size() > count) {
       throw std::runtime_error("Too many genes provided for the genome.");
     }
+    std::copy(new_genes.begin(), new_genes.end(), brain.parameterData());
     // store the genes in the base Genome<T> member
     this->_genes = new_genes;
   }
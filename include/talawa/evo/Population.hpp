@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "talawa/core/Parallel.hpp"
 #include "talawa/evo/Genome.hpp"
 #include "talawa/evo/interfaces/ICrossoverStrategy.hpp"
 #include "talawa/evo/interfaces/IFitnessStrategy.hpp"
@@ -15,6 +16,7 @@ template <typename T>
 class Population {
  private:
   bool _initialized = false;
+  bool _parallelFitness = false;
 
   // Buffers for double buffering
   std::vector<std::unique_ptr<Genome<T>>> _genomesA;
@@ -54,6 +56,11 @@ class Population {
   void setFitnessStrategy(std::unique_ptr<IFitnessStrategy<T>> f) {
     fitnessCalc = std::move(f);
   }
+  // Evaluate fitness for many genomes at once on the shared scheduler
+  // (core/Parallel.hpp). The fitness strategy must then be safe to call
+  // concurrently on different genomes.
+  void setParallelFitness(bool enabled) { _parallelFitness = enabled; }
+
   void initialize(std::unique_ptr<IGenomeGeneratorStrategy<T>> generator) {
     for (size_t i = 0; i < getGenomes().size(); i++) {
       getGenomes()[i] = generator->generateGene();
@@ -83,16 +90,24 @@ class Population {
   }
 
  private:
-  void evaluateFitness() {
-    for (auto& ind_ptr : getGenomes()) {
-      if (!ind_ptr) continue;
-      double fitness = fitnessCalc->calculateFitness(*ind_ptr);
-      ind_ptr->setFitness(static_cast<float>(fitness));
-      
-    }
+  // Scores every genome in 'genomes' (serially unless parallel fitness is on)
+  void scoreAll(std::vector<std::unique_ptr<Genome<T>>>& genomes) {
+    auto score = [&](auto first, auto last) {
+      for (auto i = first; i < last; ++i) {
+        auto& ind_ptr = genomes[i];
+        if (!ind_ptr) continue;
+        double fitness = fitnessCalc->calculateFitness(*ind_ptr);
+        ind_ptr->setFitness(static_cast<float>(fitness));
+      }
+    };
+    std::ptrdiff_t n = static_cast<std::ptrdiff_t>(genomes.size());
+    core::parallel::parallelFor(0, n, _parallelFitness ? 1 : n, score);
   }
 
+  void evaluateFitness() { scoreAll(getGenomes()); }
+
   void createNewGeneration() {
+    // Breeding uses the strategies' RNGs, so it stays serial
     for (size_t i = 0; i < _size; i++) {
       const Genome<T>& parent1 = selection->select(getGenomes());
       const Genome<T>& parent2 = selection->select(getGenomes());
@@ -101,12 +116,11 @@ class Population {
         throw std::runtime_error("Crossover returned null offspring.");
       }
       mutation->mutate(*offspring);
-      // Calculate fitness for the offspring now so we don't need a global
-      // re-evaluate
-      double offspringFitness = fitnessCalc->calculateFitness(*offspring);
-      offspring->setFitness(static_cast<float>(offspringFitness));
       getNewGenomes()[i] = std::move(offspring);
     }
+    // Calculate fitness for the offspring now so we don't need a global
+    // re-evaluate
+    scoreAll(getNewGenomes());
   }
 };
 }  // namespace talawa::evo
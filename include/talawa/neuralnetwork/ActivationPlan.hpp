@@ -0,0 +1,71 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+#include "talawa/core/Allocator.hpp"
+#include "talawa/neuralnetwork/ExecutionContext.hpp"
+#include "talawa/neuralnetwork/Layer.hpp"
+
+namespace talawa {
+namespace nn {
+
+/**
+ * @brief Memory plan of one training step (forward + backward).
+ * The step is a schedule of layer calls (see schedule()). Every buffer the
+ * layers take through trainForward/trainBackward (see
+ * ILayer::trainingBuffers) is live over the calls that write and read it.
+ * Buffers whose live ranges never meet share memory, so the whole step
+ * runs in one arena far smaller than the sum of its buffers (scratch of
+ * one layer reuses that of another, backward reuses dead forward buffers).
+ *
+ * Gradient checkpointing: with segment_layers > 1, the layers are split
+ * into segments of that many layers. Only each segment's last output (its
+ * checkpoint) is kept through the forward pass; the rest of the segment
+ * is run forward again just before its backward. Peak memory drops to
+ * about one segment's activations plus the checkpoints, for one extra
+ * forward pass over all but the last segment.
+ *
+ * Offsets are assigned greedily, largest buffer first, each at the lowest
+ * offset not taken by a buffer live at the same time.
+ * Plans are built for up to batch() rows; larger batches still work, with
+ * the buffers that no longer fit moving to storage of their own.
+ */
+class ActivationPlan {
+ public:
+  // One call of the schedule: layers[layer]->trainForward or trainBackward
+  struct Step {
+    size_t layer;
+    bool forward;
+  };
+
+  ActivationPlan(const std::vector<std::unique_ptr<ILayer>>& layers,
+                 size_t batch, size_t segment_layers = 0);
+  ActivationPlan(const ActivationPlan&) = delete;
+  ActivationPlan& operator=(const ActivationPlan&) = delete;
+
+  // The context to pass to trainForward/trainBackward
+  ExecutionContext& context() { return ctx; }
+  // The calls of one step, in order. The first layers.size() are the
+  // forward pass; the loss goes between them and the rest.
+  const std::vector<Step>& schedule() const { return steps; }
+
+  size_t batch() const { return max_batch; }
+  size_t segmentLayers() const { return segment_layers; }
+  // Layer forwards run again during the backward pass
+  size_t recomputedLayers() const;
+  // Size of the shared arena
+  size_t arenaBytes() const { return arena.size() * sizeof(float); }
+  // What the same buffers would take with no sharing at all
+  size_t unsharedBytes() const { return unshared * sizeof(float); }
+
+ private:
+  size_t max_batch;
+  size_t segment_layers;
+  std::vector<Step> steps;
+  size_t unshared = 0;  // Floats
+  core::memory::AlignedBuffer arena;
+  ExecutionContext ctx;
+};
+
+}  // namespace nn
+}  // namespace talawa
@@ -1,11 +1,22 @@
 #pragma once
+#include <memory>
+#include <mutex>
 #include <vector>
 
+#include "talawa/core/Gemm.hpp"
+#include "talawa/core/Winograd.hpp"
 #include "talawa/neuralnetwork/Layer.hpp"
 
 namespace talawa {
 namespace nn {
 
+// How a Conv2DLayer computes its convolutions
+enum class ConvAlgorithm {
+  AUTO,      // Winograd where it applies (3x3, stride 1), else GEMM
+  GEMM,      // Implicit GEMM over the im2col patches (1x1: plain GEMM)
+  WINOGRAD,  // Winograd F(2x2 or 4x4, 3x3); 3x3 stride-1 layers only
+};
+
 struct Conv2DLayerConfig {
   int filters;
   int kernel_size;
@@ -13,66 +24,145 @@ struct Conv2DLayerConfig {
   int padding = 0;  // 0 = Valid, >0 = Zero Padding
   Initializer init = Initializer::GLOROT_UNIFORM;
   Activation::Type act = Activation::RELU;
+  ConvAlgorithm algorithm = ConvAlgorithm::AUTO;
 };
 
 class Conv2DLayer : public ILayer {
+  friend class InferencePlan;  // Reads weights and geometry when compiling
+
  private:
   // Dimensions
   int depth, input_height, input_width;
   size_t filters, kernel_size, stride, padding;
   size_t output_height, output_width;
+  // NHWC: the GEMM's (Batch*OH*OW, Filters) rows are the output as they
+  // are, and kernel rows run (KernelY, KernelX, Depth) so that every tap
+  // reads one contiguous run of channels
+  Layout layout;
+  // Winograd output tile (2 or 4, see core/Winograd.hpp), 0 for GEMM. Not
+  // saved: load() picks it again from the geometry.
+  ConvAlgorithm algorithm;
+  int winograd_tile = 0;
 
   // Parameters
   core::Matrix kernels;  // Shape: (kernel_size * kernel_size * depth, filters)
   core::Matrix biases;   // Shape: (1, filters)
 
-  // Cache for Backprop
-  core::Matrix input_cache;  // Original Input
-  core::Matrix col_cache;    // Input transformed via Im2Col
-  core::Matrix z_cache;      // Pre-activation output
-  core::Matrix a_cache;      // Activated output
+  // Cache for Backprop: views of the current training step. Patches are
+  // gathered from the input again in backward, never stored.
+  core::ConstMatrixView input_view;   // Original Input
+  core::ConstMatrixView output_view;  // Activated output (image-major)
+
+  // Storage of the self-contained forward()/backward()
+  core::Matrix input_cache;  // Copy of the input
+  OwnedBuffers buffers;
+
+  // Winograd filters, reused until the kernels change. Concurrent infer()
+  // calls share it, hence the lock; copies start empty.
+  struct WinogradCache {
+    WinogradCache() = default;
+    WinogradCache(const WinogradCache&) {}
+    WinogradCache& operator=(const WinogradCache&) { return *this; }
+
+    std::mutex lock;
+    std::vector<float> kernels;  // What 'filters' were transformed from
+    std::shared_ptr<const core::winograd::Filters> filters;
+  };
+  mutable WinogradCache winograd_cache;
 
   // Gradients
   core::Matrix kernels_grad;
   core::Matrix biases_grad;
-  core::Matrix input_grad;  // dL/dX
-
-  // Cached transposed buffers to avoid frequent allocations
-  core::Matrix kernels_T;  // Transposed kernels (filters x K*K*D)
-  core::Matrix col_T;      // Transposed columns when needed
 
   // Helpers
-  core::Matrix im2col(const core::Matrix& input);
-  core::Matrix col2im(const core::Matrix& col_matrix);
+  void selectAlgorithm();
+  std::shared_ptr<const core::winograd::Filters> winogradFilters() const;
+  core::winograd::Image inputImage(const core::ConstMatrixView& input) const;
+  // Convolution + bias + activation into (Batch*OH*OW, Filters) rows
+  void convolve(const core::ConstMatrixView& input,
+                const core::MatrixView& pixels) const;
+  // dL/dX as a Winograd convolution of dZ with the flipped kernels
+  bool winogradBackward() const { return winograd_tile > 0 && padding <= 2; }
+  // 1x1, stride 1, no padding: the im2col matrix is the input itself
+  bool pointwise() const {
+    return kernel_size == 1 && stride == 1 && padding == 0;
+  }
+  // Pointwise layers read their GEMM operand in place: calls
+  // gemm(rows, pixels, first_row) for each run of (rows, Depth) input
+  // pixels with one stride, i.e. the whole batch of contiguous NHWC rows or
+  // one image at a time. first_row is the run's first pixel in the batch.
+  template <typename Gemm>
+  void pointwiseRuns(const core::ConstMatrixView& input, Gemm&& gemm) const {
+    int pixels = input_height * input_width;
+    if (layout == Layout::NHWC && input.stride == input.cols) {
+      gemm(static_cast<int>(input.rows) * pixels,
+           core::gemm::Operand{input.rawData(), depth, 1}, size_t{0});
+      return;
+    }
+    for (size_t b = 0; b < input.rows; ++b) {
+      core::gemm::Operand image =
+          layout == Layout::NHWC
+              ? core::gemm::Operand{input.row(b), depth, 1}
+              : core::gemm::Operand{input.row(b), 1, pixels};
+      gemm(pixels, image, b * pixels);
+    }
+  }
+  // Readers for core::gemm::gather(), e.g. gather(Patches{*this, input}).
+  // The (Batch*OH*OW, K*K*D) im2col matrix of 'input', read on the fly
+  struct Patches {
+    const Conv2DLayer& layer;
+    core::ConstMatrixView input;
+    void operator()(int row, int col, int count, float* dst) const;
+  };
+  // The (Batch*H*W, K*K*F) patches of pixel-major dZ that give dL/dX
+  struct GradientPatches {
+    const Conv2DLayer& layer;
+    core::ConstMatrixView dZ;
+    void operator()(int row, int col, int count, float* dst) const;
+  };
+  // NCHW only: (Batch*OH*OW, Filters) <-> (Batch, F*OH*OW)
+  void toImageMajor(const core::ConstMatrixView& pixels,
+                    const core::MatrixView& out) const;
+  void toPixelMajor(const core::ConstMatrixView& image,
+                    const core::MatrixView& out) const;
 
  public:
-  Conv2DLayer();
+  explicit Conv2DLayer(Layout layout = Layout::NCHW);
 
   // Profiling accumulators (seconds) to help narrow hotspots
-  double profiling_im2col = 0.0;
-  double profiling_gemm = 0.0;
-  double profiling_bias = 0.0;
-  double profiling_activation = 0.0;
+  double profiling_gemm = 0.0;  // Includes the fused bias + activation
   double profiling_reshape = 0.0;
 
-  double profiling_col2im = 0.0;
   double profiling_kernels_grad = 0.0;
   double profiling_bias_grad = 0.0;
-  double profiling_dcol = 0.0;
+  double profiling_dcol = 0.0;  // dL/dX, an implicit GEMM over dZ
   double profiling_act_backprop = 0.0;
   Conv2DLayer(int depth, int height, int width, int filters, int kernel_size,
               int stride = 1, int padding = 0,
               Initializer init = Initializer::GLOROT_UNIFORM,
-              Activation act = Activation::RELU);
+              Activation act = Activation::RELU,
+              Layout layout = Layout::NCHW,
+              ConvAlgorithm algorithm = ConvAlgorithm::AUTO);
 
-  core::Matrix forward(const core::Matrix& input,
+  core::Matrix forward(const core::ConstMatrixView& input,
                        bool is_training = true) override;
   core::Matrix backward(const core::Matrix& outputGradients) override;
+  core::ConstMatrixView infer(const core::ConstMatrixView& input,
+                              ExecutionContext& ctx) const override;
+  core::ConstMatrixView trainForward(const core::ConstMatrixView& input,
+                                     ExecutionContext& ctx) override;
+  core::ConstMatrixView trainBackward(
+      const core::ConstMatrixView& outputGradients,
+      ExecutionContext& ctx) override;
+  std::vector<BufferRequest> trainingBuffers(size_t batch) const override;
 
   std::vector<core::Matrix*> getParameters() override;
   std::vector<core::Matrix*> getParameterGradients() override;
 
   Shape getOutputShape() const override;
+  Layout getLayout() const { return layout; }
+  // Output tile edge of the Winograd path, 0 if convolutions run as GEMMs
+  int winogradTile() const { return winograd_tile; }
   std::string info() const override;
 
   void save(std::ostream&) const override;
@@ -0,0 +1,47 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+#include "talawa/core/Matrix.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+namespace talawa {
+namespace nn {
+
+/**
+ * @brief Synchronous data-parallel training on one machine.
+ * Each mini-batch is split into row shards, one per replica. Every replica
+ * runs forward + backward on its shard at the same time (on the shared
+ * thread pool), then the gradients are all-reduced in shared memory into
+ * the original network and its optimizer takes a single step. The result
+ * matches NeuralNetwork::train on the whole batch, up to float rounding.
+ *
+ * Replica 0 is the network itself; the others are clones whose weights are
+ * refreshed from it before every step, so the network may also be trained
+ * or modified directly between calls. Only the network's optimizer is used.
+ */
+class DataParallelTrainer {
+ public:
+  // replicas = 0 uses one per thread of parallel::threadBudget()
+  explicit DataParallelTrainer(NeuralNetwork& network, int replicas = 0);
+
+  // One optimizer step on the whole batch; returns its mean loss
+  float train(const core::ConstMatrixView& input,
+              const core::ConstMatrixView& target);
+
+  int replicaCount() const { return static_cast<int>(clones.size()) + 1; }
+
+  // Shards are never smaller than this; small batches use fewer replicas
+  static constexpr size_t MIN_SHARD_ROWS = 8;
+
+ private:
+  NeuralNetwork& network;
+  std::vector<std::unique_ptr<NeuralNetwork>> clones;  // Replicas 1..N-1
+
+  NeuralNetwork& replica(size_t r) { return r == 0 ? network : *clones[r - 1]; }
+  // Sums the gradients of replicas [1, shards) into the network's
+  void allReduce(size_t shards);
+};
+
+}  // namespace nn
+}  // namespace talawa
@@ -18,6 +18,8 @@ struct DenseLayerConfig {
 };
 
 class DenseLayer : public ILayer {
+  friend class InferencePlan;  // Reads weights and geometry when compiling
+
  private:
   // Layer dimensions
   size_t in;
@@ -27,20 +29,18 @@ class DenseLayer : public ILayer {
   core::Matrix weights;  // Shape: (input_size, output_size)
   core::Matrix biases;   // Shape: (1, output_size)
 
-  // Cache for backpropagation
-  core::Matrix input_cache;            // X from forward pass
-  core::Matrix z_cache;                // WX+B from forward pass
-  core::Matrix a_cache;                // Activation from forward pass
-  core::Matrix input_gradients_cache;  // Pre-allocated for backward pass
+  // Cache for backpropagation: views of the current training step
+  core::ConstMatrixView input_view;  // X from forward pass
+  core::ConstMatrixView a_view;      // Activation from forward pass
+
+  // Storage of the self-contained forward()/backward()
+  core::Matrix input_cache;  // Copy of X
+  OwnedBuffers buffers;
 
   // Gradients
   core::Matrix weights_grad;  // Same shape as weights
   core::Matrix biases_grad;
 
-  core::Matrix input_T_cache;    // To store input_cache.transpose()
-  core::Matrix weights_T_cache;  // To store weights.transpose()
-  core::Matrix dZ;               // To store activation gradient
-
  public:
   DenseLayer();
   DenseLayer(size_t input_dim, size_t neurons,
@@ -48,9 +48,17 @@ class DenseLayer : public ILayer {
              Initializer init = Initializer::GLOROT_UNIFORM);
 
   // Core Operations
-  core::Matrix forward(const core::Matrix& input,
+  core::Matrix forward(const core::ConstMatrixView& input,
                        bool is_training = true) override;
   core::Matrix backward(const core::Matrix& outputGradients) override;
+  core::ConstMatrixView infer(const core::ConstMatrixView& input,
+                              ExecutionContext& ctx) const override;
+  core::ConstMatrixView trainForward(const core::ConstMatrixView& input,
+                                     ExecutionContext& ctx) override;
+  core::ConstMatrixView trainBackward(
+      const core::ConstMatrixView& outputGradients,
+      ExecutionContext& ctx) override;
+  std::vector<BufferRequest> trainingBuffers(size_t batch) const override;
 
   // Optimizer
 
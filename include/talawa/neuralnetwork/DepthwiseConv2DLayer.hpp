@@ -0,0 +1,87 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+#include "talawa/neuralnetwork/Layer.hpp"
+
+namespace talawa {
+namespace nn {
+
+// One kernel per input channel, no mixing across channels: depth in, depth
+// out. Followed by a pointwise Conv2DLayerConfig{filters, 1} it makes a
+// depthwise-separable convolution, K*K + F weights per input channel
+// instead of the K*K*F of a full convolution.
+struct DepthwiseConv2DLayerConfig {
+  int kernel_size = 3;
+  int stride = 1;
+  int padding = 0;  // 0 = Valid, >0 = Zero Padding
+  Initializer init = Initializer::GLOROT_UNIFORM;
+  Activation::Type act = Activation::RELU;
+};
+
+class DepthwiseConv2DLayer : public ILayer {
+  friend class InferencePlan;  // Runs convolve() on its own buffers
+
+ private:
+  // Dimensions
+  int depth, input_height, input_width;
+  int kernel_size, stride, padding;
+  int output_height, output_width;
+  Layout layout;
+
+  // Parameters
+  core::Matrix kernels;  // Shape: (kernel_size * kernel_size, depth)
+  core::Matrix biases;   // Shape: (1, depth)
+
+  // Cache for Backprop: views of the current training step
+  core::ConstMatrixView input_view;
+  core::ConstMatrixView output_view;
+
+  // Storage of the self-contained forward()/backward()
+  core::Matrix input_cache;
+  OwnedBuffers buffers;
+
+  // Gradients
+  core::Matrix kernels_grad;
+  core::Matrix biases_grad;
+
+  // Convolution + bias + activation, 'output' being (Batch, D*OH*OW)
+  void convolve(const core::ConstMatrixView& input,
+                const core::MatrixView& output) const;
+
+ public:
+  explicit DepthwiseConv2DLayer(Layout layout = Layout::NCHW);
+  DepthwiseConv2DLayer(int depth, int height, int width, int kernel_size = 3,
+                       int stride = 1, int padding = 0,
+                       Initializer init = Initializer::GLOROT_UNIFORM,
+                       Activation act = Activation::RELU,
+                       Layout layout = Layout::NCHW);
+
+  core::Matrix forward(const core::ConstMatrixView& input,
+                       bool is_training = true) override;
+  core::Matrix backward(const core::Matrix& outputGradients) override;
+  core::ConstMatrixView infer(const core::ConstMatrixView& input,
+                              ExecutionContext& ctx) const override;
+  core::ConstMatrixView trainForward(const core::ConstMatrixView& input,
+                                     ExecutionContext& ctx) override;
+  core::ConstMatrixView trainBackward(
+      const core::ConstMatrixView& outputGradients,
+      ExecutionContext& ctx) override;
+  std::vector<BufferRequest> trainingBuffers(size_t batch) const override;
+
+  std::vector<core::Matrix*> getParameters() override;
+  std::vector<core::Matrix*> getParameterGradients() override;
+
+  Shape getOutputShape() const override;
+  Layout getLayout() const { return layout; }
+  std::string info() const override;
+
+  void save(std::ostream&) const override;
+  void load(std::istream&) override;
+  std::unique_ptr<ILayer> clone() const override {
+    return std::make_unique<DepthwiseConv2DLayer>(*this);
+  }
+};
+
+}  // namespace nn
+}  // namespace talawa
@@ -0,0 +1,103 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "talawa/core/Matrix.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+namespace talawa {
+namespace nn {
+
+struct DistributedConfig {
+  int rank = 0;        // This worker, in [0, world_size)
+  int world_size = 1;  // Number of worker processes
+  // Rank 0's host and the port it runs the rendezvous on
+  std::string master_addr = "127.0.0.1";
+  int master_port = 29500;
+  // Steps between parameter checks (0 = never)
+  int verify_every = 100;
+  // Give up on the rendezvous after this long
+  int timeout_ms = 30'000;
+
+  // TALAWA_RANK, TALAWA_WORLD_SIZE, TALAWA_MASTER_ADDR, TALAWA_MASTER_PORT
+  static DistributedConfig fromEnv();
+};
+
+/**
+ * @brief Synchronous data-parallel training across processes or hosts.
+ * Every worker holds a full copy of the network and trains on its own
+ * mini-batch. Gradients are summed with a ring all-reduce over TCP and
+ * averaged, then every worker takes the same optimizer step, so the copies
+ * stay identical. Workers should use equal batch sizes: the result then
+ * matches NeuralNetwork::train on all their batches combined.
+ *
+ * - Rendezvous: every worker connects to rank 0 (master_addr:master_port),
+ *   which hands out the ring addresses; rank 0's weights are then
+ *   broadcast so all workers start from the same parameters.
+ * - Overlap: a layer's gradients are reduced on a communication thread as
+ *   soon as its backward finishes, while earlier layers are still running
+ *   their backward pass.
+ * - Every verify_every steps the workers compare parameter hashes and
+ *   throw if any copy has diverged.
+ *
+ * All workers must call the collective methods (the constructor, train,
+ * parametersInSync, broadcastParameters) in the same order.
+ * @note POSIX sockets only.
+ */
+class DistributedTrainer {
+ public:
+  DistributedTrainer(NeuralNetwork& network, const DistributedConfig& config);
+  ~DistributedTrainer();
+  DistributedTrainer(const DistributedTrainer&) = delete;
+  DistributedTrainer& operator=(const DistributedTrainer&) = delete;
+
+  // One step on this worker's batch; returns the loss averaged over workers
+  float train(const core::ConstMatrixView& input,
+              const core::ConstMatrixView& target);
+
+  // True on every worker iff all parameter copies are bit-identical
+  bool parametersInSync();
+  // Overwrites every worker's parameters with rank 0's
+  void broadcastParameters();
+
+  int rank() const { return config.rank; }
+  int worldSize() const { return config.world_size; }
+
+ private:
+  NeuralNetwork& network;
+  DistributedConfig config;
+  long steps = 0;
+
+  // Ring links: we send to rank + 1 and receive from rank - 1
+  int right_fd = -1;
+  int left_fd = -1;
+  void rendezvous();
+
+  // Sums n floats element-wise across all workers, in place
+  void allReduce(float* data, size_t n);
+  // Sends to the right neighbour while receiving from the left one
+  void exchange(const void* send, size_t send_bytes, void* recv,
+                size_t recv_bytes);
+  std::vector<float> scratch;  // Incoming chunk of allReduce
+
+  // Communication thread: reduces queued layers' gradients in order
+  std::thread comm;
+  std::mutex lock;
+  std::condition_variable wake, idle;
+  std::deque<size_t> pending;  // Layer indices
+  bool busy = false;
+  bool stopping = false;
+  std::exception_ptr comm_error;
+  void commLoop();
+  void reduceLayer(size_t layer);
+  void waitForComm();
+};
+
+}  // namespace nn
+}  // namespace talawa
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "talawa/core/Allocator.hpp"
+#include "talawa/core/MatrixView.hpp"
+
+namespace talawa {
+namespace nn {
+
+/**
+ * @brief Per-thread scratch memory for inference.
+ * Layers keep only their weights; every intermediate buffer of a reentrant
+ * forward pass (ILayer::infer) comes from the context passed in. Threads
+ * can therefore share one network (one copy of the weights) as long as
+ * each owns its own context.
+ *
+ * Buffers are keyed by (owner, slot), typically (layer, n). They keep their
+ * storage between calls and only grow, so after the first call at the
+ * largest batch size a context never allocates again.
+ * @note A context must not be used by two threads at once.
+ */
+class ExecutionContext {
+ public:
+  ExecutionContext() = default;
+  ExecutionContext(const ExecutionContext&) = delete;
+  ExecutionContext& operator=(const ExecutionContext&) = delete;
+  ExecutionContext(ExecutionContext&&) = default;
+  ExecutionContext& operator=(ExecutionContext&&) = default;
+
+  // A contiguous (rows x cols) buffer; contents are unspecified
+  core::MatrixView buffer(const void* owner, int slot, size_t rows,
+                          size_t cols);
+  // Grows a buffer up front so later calls need no allocation
+  void reserve(const void* owner, int slot, size_t count);
+  // Makes a buffer use 'count' caller-owned floats at 'data' (e.g. a slice
+  // of a planned arena, see ActivationPlan). Asking for more than that
+  // moves it back to storage of its own.
+  void bind(const void* owner, int slot, float* data, size_t count);
+
+  // Total floats held, across every buffer
+  size_t capacity() const;
+
+ private:
+  struct Entry {
+    const void* owner;
+    int slot;
+    core::memory::AlignedBuffer storage;
+  };
+  Entry& find(const void* owner, int slot);
+
+  // A handful of entries per layer: a linear scan beats hashing
+  std::vector<Entry> entries;
+};
+
+}  // namespace nn
+}  // namespace talawa
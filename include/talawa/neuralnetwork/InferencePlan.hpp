@@ -0,0 +1,78 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+#include "talawa/core/Activation.hpp"
+#include "talawa/core/Gemm.hpp"
+#include "talawa/core/Matrix.hpp"
+#include "talawa/core/Winograd.hpp"
+#include "talawa/neuralnetwork/ExecutionContext.hpp"
+#include "talawa/neuralnetwork/Layer.hpp"
+
+namespace talawa {
+namespace nn {
+
+/**
+ * @brief Frozen, allocation-free forward pass of a network.
+ * Built by NeuralNetwork::compileForInference(max_batch). Compiling
+ * snapshots the weights (later training does not change the plan), packs
+ * every GEMM operand once, fuses bias + activation into the GEMMs (and the
+ * conv output reshape into the same step), and sizes every intermediate
+ * buffer for max_batch. predict() then never touches the heap.
+ * No training caches, gradients or optimizer state are kept.
+ *
+ * The plan itself is immutable: threads can share one plan, each passing
+ * its own ExecutionContext (see createContext()).
+ */
+class InferencePlan {
+ public:
+  InferencePlan() = default;
+  InferencePlan(const std::vector<std::unique_ptr<ILayer>>& layers,
+                size_t input_size, size_t max_batch);
+
+  // Up to maxBatch() rows of inputSize() features. The returned view lives
+  // in ctx and is overwritten by its next use.
+  core::ConstMatrixView predict(const core::ConstMatrixView& input,
+                                ExecutionContext& ctx) const;
+  // Same, using a context owned by the plan (one thread at a time)
+  core::ConstMatrixView predict(const core::ConstMatrixView& input);
+
+  // A context with every buffer already sized for maxBatch()
+  ExecutionContext createContext() const;
+
+  size_t maxBatch() const { return max_batch; }
+  size_t inputSize() const { return input_size; }
+  size_t outputSize() const { return output_size; }
+
+ private:
+  enum class StepType { DENSE, CONV2D, DEPTHWISE2D, POOL2D, LAYER };
+
+  struct Step {
+    StepType type;
+    size_t out_cols;  // Features per batch item after this step
+    core::Activation activation;
+    core::gemm::PackedB weights;  // DENSE, CONV2D
+    // CONV2D layers that run Winograd: their transformed filters instead
+    std::shared_ptr<const core::winograd::Filters> winograd;
+    core::Matrix biases;
+    // CONV2D/POOL2D: a copy holding only the geometry.
+    // DEPTHWISE2D: a copy with its weights, which it reads unpacked.
+    // LAYER: any other layer, run through its own infer().
+    std::unique_ptr<ILayer> layer;
+  };
+
+  std::vector<Step> steps;
+  size_t input_size = 0;
+  size_t output_size = 0;
+  size_t max_batch = 0;
+
+  // Context buffers, keyed by (steps.data(), slot). Activations ping-pong
+  // between two buffers; NCHW conv steps share the GEMM scratch.
+  enum Slot { PING, PONG, PIXELS };
+  size_t slot_sizes[3] = {0, 0, 0};
+
+  ExecutionContext own_context;
+};
+
+}  // namespace nn
+}  // namespace talawa
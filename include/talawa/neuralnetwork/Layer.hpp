@@ -2,8 +2,10 @@
 #include "talawa/core/Activation.hpp"
 #include "talawa/core/Initializer.hpp"
 #include "talawa/core/Matrix.hpp"
+#include "talawa/neuralnetwork/ExecutionContext.hpp"
 
 #include <memory>
+#include <vector>
 
 #define THROW_LAYER_ERROR(msg) THROW_talawa_ERROR("Layer", msg)
 namespace talawa {
@@ -20,11 +22,65 @@ struct Shape {
   size_t flat() const { return depth * height * width; }
 };
 
+// Order of a (depth, height, width) image within its batch row
+enum class Layout {
+  NCHW,  // Channel planes: [d][y][x]
+  NHWC,  // Channels last, interleaved per pixel: [y][x][d]
+};
+
+// How long a training buffer must survive, relative to the layer's own
+// forward and backward calls in one training step (see ActivationPlan)
+enum class BufferLifetime {
+  FORWARD,         // Scratch of forward only
+  SAVED,           // From forward until this layer's backward (outputs)
+  BACKWARD,        // Scratch of backward only
+  INPUT_GRADIENT,  // Written by backward, read by the previous backward
+};
+
+// One buffer a layer takes from its ExecutionContext during training
+struct BufferRequest {
+  int slot;
+  size_t count;  // Floats
+  BufferLifetime lifetime;
+};
+
+// A layer's own buffers for the self-contained forward()/backward(): a
+// context that copies as empty, so layers stay copyable
+class OwnedBuffers : public ExecutionContext {
+ public:
+  OwnedBuffers() = default;
+  OwnedBuffers(const OwnedBuffers&) {}
+  OwnedBuffers& operator=(const OwnedBuffers&) { return *this; }
+};
+
 class ILayer {
  public:
   virtual ~ILayer() = default;
-  virtual Matrix forward(const Matrix& input, bool is_training = true) = 0;
+  virtual Matrix forward(const ConstMatrixView& input,
+                         bool is_training = true) = 0;
   virtual Matrix backward(const Matrix& outputGradients) = 0;
+
+  // Reentrant inference: reads only the weights and takes every buffer from
+  // ctx, so threads may share the layer. The result lives in ctx.
+  // The default serialises forward(input, false) for layers that have no
+  // reentrant path (e.g. ones injected through the builder).
+  virtual ConstMatrixView infer(const ConstMatrixView& input,
+                                ExecutionContext& ctx) const;
+
+  // Training on planned buffers: every buffer written comes from ctx,
+  // keyed (this, slot), and nothing is copied in. trainForward may keep a
+  // view of its input, which stays valid until this layer's backward, and
+  // its result stays valid until then too. NeuralNetwork places the
+  // buffers of all layers in one arena by liveness (ActivationPlan).
+  // The defaults wrap forward()/backward() for layers without such a path.
+  virtual ConstMatrixView trainForward(const ConstMatrixView& input,
+                                       ExecutionContext& ctx);
+  virtual ConstMatrixView trainBackward(const ConstMatrixView& outputGradients,
+                                        ExecutionContext& ctx);
+  // The buffers trainForward/trainBackward take for a batch of 'batch' rows
+  virtual std::vector<BufferRequest> trainingBuffers(size_t /*batch*/) const {
+    return {};
+  }
   virtual std::vector<Matrix*> getParameters() = 0;
   virtual std::vector<Matrix*> getParameterGradients() = 0;
 
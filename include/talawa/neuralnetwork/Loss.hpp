@@ -21,10 +21,12 @@ class Loss {
   virtual ~Loss() = default;
 
   // Calculates the scalar loss value (for tracking progress)
-  virtual float calculate(const Matrix& prediction, const Matrix& target) = 0;
+  virtual float calculate(const Matrix& prediction,
+                          const ConstMatrixView& target) = 0;
 
   // Calculates the gradient dL/dY (to start Backpropagation)
-  virtual Matrix gradient(const Matrix& prediction, const Matrix& target) = 0;
+  virtual Matrix gradient(const Matrix& prediction,
+                          const ConstMatrixView& target) = 0;
 
   virtual std::string getName() const = 0;
   virtual LossInputType getInputType() const = 0;
@@ -39,8 +41,10 @@ class HuberLoss : public Loss {
  private:
   float _delta = 1.f;  // Can be tunable
  public:
-  float calculate(const Matrix& prediction, const Matrix& target) override;
-  Matrix gradient(const Matrix& prediction, const Matrix& target) override;
+  float calculate(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
+  Matrix gradient(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
   std::string getName() const override { return "Huber Loss"; }
   LossInputType getInputType() const override {
     return LossInputType::RAW_VALUES;
@@ -53,8 +57,10 @@ class HuberLoss : public Loss {
 // Best for: Regression (predicting house prices, coordinates, etc.)
 class MeanSquaredError : public Loss {
  public:
-  float calculate(const Matrix& prediction, const Matrix& target) override;
-  Matrix gradient(const Matrix& prediction, const Matrix& target) override;
+  float calculate(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
+  Matrix gradient(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
   std::string getName() const override { return "Mean Squared Error"; }
   LossInputType getInputType() const override {
     return LossInputType::RAW_VALUES;
@@ -66,8 +72,10 @@ class MeanSquaredError : public Loss {
 
 class CrossEntropyLoss : public Loss {
  public:
-  float calculate(const Matrix& prediction, const Matrix& target) override;
-  Matrix gradient(const Matrix& prediction, const Matrix& target) override;
+  float calculate(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
+  Matrix gradient(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
   std::string getName() const override { return "Cross Entropy Loss"; }
   LossInputType getInputType() const override { return LossInputType::LOGITS; }
   std::unique_ptr<Loss> clone() const override {
@@ -77,8 +85,10 @@ class CrossEntropyLoss : public Loss {
 
 class CategoricalCrossEntropyLoss : public Loss {
  public:
-  float calculate(const Matrix& prediction, const Matrix& target) override;
-  Matrix gradient(const Matrix& prediction, const Matrix& target) override;
+  float calculate(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
+  Matrix gradient(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
   std::string getName() const override {
     return "Categorical Cross Entropy Loss";
   }
@@ -88,8 +98,10 @@ class CategoricalCrossEntropyLoss : public Loss {
 };
 class CrossEntropyWithLogitsLoss : public Loss {
  public:
-  float calculate(const Matrix& prediction, const Matrix& target) override;
-  Matrix gradient(const Matrix& prediction, const Matrix& target) override;
+  float calculate(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
+  Matrix gradient(const Matrix& prediction,
+                  const ConstMatrixView& target) override;
   std::string getName() const override {
     return "Cross Entropy With Logits Loss";
   }
@@ -98,10 +110,12 @@ class CrossEntropyWithLogitsLoss : public Loss {
 
 class EmptyLoss : public Loss {
  public:
-  float calculate(const Matrix& prediction, const Matrix& target) override {
+  float calculate(const Matrix& prediction,
+                  const ConstMatrixView& target) override {
     return 0.0f;
   }
-  Matrix gradient(const Matrix& prediction, const Matrix& target) override {
+  Matrix gradient(const Matrix& prediction,
+                  const ConstMatrixView& target) override {
     return Matrix::zeros(prediction.rows, prediction.cols);
   }
   std::string getName() const override { return "Empty Loss"; }
@@ -10,8 +10,11 @@
 
 #include "talawa/core/Matrix.hpp"
 #include "talawa/core/Optimizer.hpp"
+#include "talawa/neuralnetwork/ActivationPlan.hpp"
 #include "talawa/neuralnetwork/Conv2DLayer.hpp"
 #include "talawa/neuralnetwork/DenseLayer.hpp"
+#include "talawa/neuralnetwork/DepthwiseConv2DLayer.hpp"
+#include "talawa/neuralnetwork/InferencePlan.hpp"
 #include "talawa/neuralnetwork/Layer.hpp"
 #include "talawa/neuralnetwork/Loss.hpp"
 #include "talawa/neuralnetwork/Pooling2DLayer.hpp"
@@ -19,7 +22,8 @@
 namespace talawa::nn {
 
 using LayerConfigVariant =
-    std::variant<DenseLayerConfig, Conv2DLayerConfig, Pooling2DLayerConfig>;
+    std::variant<DenseLayerConfig, Conv2DLayerConfig, Pooling2DLayerConfig,
+                 DepthwiseConv2DLayerConfig>;
 class NeuralNetwork;  // Forward declaration
 class NeuralNetworkBuilder {
  private:
@@ -32,6 +36,12 @@ class NeuralNetworkBuilder {
   NeuralNetworkBuilder& add(LayerConfigVariant config);
   NeuralNetworkBuilder& setOptimizer(std::unique_ptr<core::Optimizer> opt);
   NeuralNetworkBuilder& setLossFunction(std::unique_ptr<loss::Loss> loss);
+  // Layout of every convolution/pooling activation, and so of the input
+  // images (NCHW by default). With NHWC, convolutions need no reshape
+  // passes; images must then be fed channels-last too.
+  NeuralNetworkBuilder& setLayout(Layout layout);
+  // Gradient checkpointing (see NeuralNetwork::setCheckpointing)
+  NeuralNetworkBuilder& setCheckpointing(size_t segment_layers);
   NeuralNetworkBuilder& inject(
       std::function<std::pair<std::unique_ptr<ILayer>, Shape>(const Shape&)>
           layer_creator);
@@ -43,6 +53,8 @@ class NeuralNetworkBuilder {
   std::unique_ptr<core::Optimizer> optimizer = std::make_unique<core::SGD>();
   std::unique_ptr<loss::Loss> loss_fn =
       std::make_unique<loss::MeanSquaredError>();
+  size_t checkpoint_segment = 0;
+  Layout layout = Layout::NCHW;
   NeuralNetworkBuilder() = default;  // Private constructor
 };
 class NeuralNetwork : public rl::agent::ILearnable {
@@ -66,7 +78,11 @@ class NeuralNetwork : public rl::agent::ILearnable {
     configs = other.configs;
     input_shape = other.input_shape;
     m_optimized_act = other.m_optimized_act;
-    _totalParameters = other._totalParameters;
+    per_layer_updates = other.per_layer_updates;
+    checkpoint_segment = other.checkpoint_segment;
+
+    // The cloned layers own their parameters: move them into our own arena
+    bindParameters();
   }
   const std::vector<std::unique_ptr<ILayer>>& getLayers() const {
     return layers;
@@ -81,11 +97,80 @@ class NeuralNetwork : public rl::agent::ILearnable {
     std::swap(loss_fn, tmp.loss_fn);
     std::swap(input_shape, tmp.input_shape);
     std::swap(configs, tmp.configs);
+    std::swap(param_arena, tmp.param_arena);
+    std::swap(grad_arena, tmp.grad_arena);
+    std::swap(param_list, tmp.param_list);
+    std::swap(grad_list, tmp.grad_list);
+    std::swap(layer_tensors, tmp.layer_tensors);
+    std::swap(training_plan, tmp.training_plan);
+    std::swap(_totalParameters, tmp._totalParameters);
     m_optimized_act = tmp.m_optimized_act;
+    per_layer_updates = tmp.per_layer_updates;
+    checkpoint_segment = tmp.checkpoint_segment;
     return *this;
   }
-  core::Matrix predict(const core::Matrix& input) const;
-  float train(const core::Matrix& input, const core::Matrix& target);
+  // Inputs/targets may be views (e.g. a mini-batch of a larger dataset)
+  core::Matrix predict(const core::ConstMatrixView& input) const;
+  // Reentrant predict: all scratch comes from ctx, so any number of
+  // threads may share this network with one context each. The result
+  // lives in ctx and is overwritten by its next use.
+  core::ConstMatrixView predict(const core::ConstMatrixView& input,
+                                ExecutionContext& ctx) const;
+  float train(const core::ConstMatrixView& input,
+              const core::ConstMatrixView& target);
+  // train() split in two, so trainers can combine the gradients of several
+  // replicas before the single optimizer step.
+  // Forward + backward only: fills every layer's gradients, returns the loss.
+  // after_backward(i) runs as soon as layers[i]'s gradients are final
+  // (last layer first), e.g. to start communicating them early.
+  float computeGradients(
+      const core::ConstMatrixView& input, const core::ConstMatrixView& target,
+      const std::function<void(size_t)>& after_backward = {});
+  // One optimizer step with the current gradients
+  void applyGradients();
+
+  // Training steps run on one arena of activation buffers, shared by
+  // liveness (see ActivationPlan). It is planned on the first step and
+  // again whenever a larger batch comes in; planning ahead for the largest
+  // batch avoids the replanning.
+  void planTraining(size_t max_batch);
+  // Gradient checkpointing: only every segment_layers-th layer's output is
+  // kept through the forward pass, the others are recomputed segment by
+  // segment during the backward. Less activation memory for about one
+  // more forward pass; 0 or 1 turns it off (see ActivationPlan).
+  void setCheckpointing(size_t segment_layers);
+  size_t checkpointing() const { return checkpoint_segment; }
+  const ActivationPlan* activationPlan() const { return training_plan.get(); }
+
+  // Per-layer updates: train() updates each layer's parameters right after
+  // its backward, while its gradients are still in cache, instead of in one
+  // pass after the whole backward. Same result; off by default. Steps that
+  // need every gradient first (gradient-norm clipping, see
+  // Optimizer::canSplitSteps) still run after the backward.
+  void setPerLayerUpdates(bool enabled) { per_layer_updates = enabled; }
+  bool perLayerUpdates() const { return per_layer_updates; }
+
+  // Every layer's parameters / gradients, in matching order
+  std::vector<core::Matrix*> parameters();
+  std::vector<core::Matrix*> gradients();
+
+  // All parameters live back to back, in parameters() order, in one aligned
+  // buffer of getTotalParameters() floats; all gradients in another. The
+  // layers' matrices are views into them, so the optimizer sweeps the
+  // whole network as one range and copying all weights is one memcpy.
+  float* parameterData() { return param_arena.rawData(); }
+  const float* parameterData() const { return param_arena.rawData(); }
+  float* gradientData() { return grad_arena.rawData(); }
+
+  // Checkpoint of the parameters only (one write of the arena); loading
+  // requires a network of the same architecture
+  bool saveParameters(const std::string& filename) const;
+  bool loadParameters(const std::string& filename);
+
+  // Frozen copy of the forward pass for serving: packed weights, fused
+  // ops and buffers preallocated for up to max_batch rows, so its predict()
+  // never allocates. Recompile after training to pick up new weights.
+  InferencePlan compileForInference(size_t max_batch = 1) const;
   // Persistence helpers
   bool saveToFile(const std::string& filename) const;
   static std::unique_ptr<NeuralNetwork> loadFromFile(
@@ -125,7 +210,20 @@ class NeuralNetwork : public rl::agent::ILearnable {
 
  private:
   Shape get_input_shape() const;
-  void recalcTotalParameters();  // Recompute _totalParameters from layers
+  // Moves every layer's parameters and gradients into the arenas and
+  // recomputes _totalParameters and the lists below
+  void bindParameters();
+  core::Matrix param_arena;  // (1 x total)
+  core::Matrix grad_arena;   // (1 x total)
+  // parameters() / gradients(), cached for the optimizer
+  std::vector<core::Matrix*> param_list;
+  std::vector<core::Matrix*> grad_list;
+  // layers[i] owns tensors [layer_tensors[i], layer_tensors[i + 1])
+  std::vector<size_t> layer_tensors;
+  bool per_layer_updates = false;
+  size_t checkpoint_segment = 0;
+  // Bound to these layers: copies start without one
+  std::unique_ptr<ActivationPlan> training_plan;
   NeuralNetwork() = default;     // Private constructor (use Builder)
   std::vector<LayerConfigVariant> configs;
 
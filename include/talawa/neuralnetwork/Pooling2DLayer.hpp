@@ -1,4 +1,7 @@
 #pragma once
+#include <vector>
+
+#include "talawa/core/Kernels.hpp"
 #include "talawa/neuralnetwork/Layer.hpp"
 
 namespace talawa {
@@ -13,34 +16,66 @@ struct Pooling2DLayerConfig {
 };
 
 class Pooling2DLayer : public ILayer {
+  friend class InferencePlan;  // Reads weights and geometry when compiling
+
  private:
   // Configuration
   PoolingType type;
   int depth, input_height, input_width;
   int pool_size, stride;
   int output_height, output_width;
+  Layout layout;
 
   // Cache for Backprop
-  // MAX: Stores the flat index of the "winning" pixel
-  std::vector<std::vector<int>> max_indices_cache;
+  // MAX: position of the "winning" input of every output, within its batch
+  // row: one flat (Batch, D*OH*OW) buffer, reused across steps
+  std::vector<int> max_indices;
 
   // AVERAGE: We don't need a complex cache, just the input shape
   // (We use input dimensions to allocate dX)
 
+  // Storage of the self-contained forward()/backward()
+  OwnedBuffers buffers;
+
+  // Work is split into units that own some channels of one image: a plane
+  // (NCHW) or a block of channels (NHWC). Pooling never mixes channels, so
+  // units read and write disjoint parts of every row.
+  struct Unit {
+    size_t image;
+    std::ptrdiff_t in, out;  // Offsets of the unit's first channel in a row
+    core::kernels::PoolRow row;
+  };
+  std::ptrdiff_t unitsPerImage() const;
+  Unit unit(std::ptrdiff_t index) const;
+
+  // Writes the pooled input into 'output' (Batch, D*OH*OW), recording the
+  // winning inputs in 'max_indices' (laid out like output) if given
+  void pool(const core::ConstMatrixView& input, const core::MatrixView& output,
+            int* max_indices) const;
+
  public:
-  Pooling2DLayer();
+  explicit Pooling2DLayer(Layout layout = Layout::NCHW);
   Pooling2DLayer(int depth, int height, int width,
                  PoolingType type = PoolingType::MAX, int pool_size = 2,
-                 int stride = 2);
+                 int stride = 2, Layout layout = Layout::NCHW);
 
-  core::Matrix forward(const core::Matrix& input,
+  core::Matrix forward(const core::ConstMatrixView& input,
                        bool is_training = true) override;
   core::Matrix backward(const core::Matrix& outputGradients) override;
+  core::ConstMatrixView infer(const core::ConstMatrixView& input,
+                              ExecutionContext& ctx) const override;
+  core::ConstMatrixView trainForward(const core::ConstMatrixView& input,
+                                     ExecutionContext& ctx) override;
+  core::ConstMatrixView trainBackward(
+      const core::ConstMatrixView& outputGradients,
+      ExecutionContext& ctx) override;
+  std::vector<BufferRequest> trainingBuffers(size_t batch) const override;
 
   std::vector<core::Matrix*> getParameters() override { return {}; }
   std::vector<core::Matrix*> getParameterGradients() override { return {}; }
 
   Shape getOutputShape() const override;
+  Layout getLayout() const { return layout; }
   std::string info() const override;
 
   void save(std::ostream& out) const override;
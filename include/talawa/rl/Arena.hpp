@@ -9,6 +9,7 @@
 #include <set>
 #include <vector>
 
+#include "talawa/core/Parallel.hpp"
 #include "talawa/env/interfaces/IEnvironment.hpp"
 #include "talawa/rl/IAgent.hpp"
 #include "talawa/rl/QTable.hpp"
@@ -258,5 +259,38 @@ class Arena {
     }
     return stats;
   }
+
+  // --- Parallel rollouts ---
+  // Each arena needs its own environment and agents. Arenas run as tasks on
+  // the shared scheduler (core/Parallel.hpp), and networks inside them still
+  // split their own GEMMs across whichever threads are idle, so outer and
+  // inner parallelism stay within one thread budget.
+
+  // Plays one match in every arena at the same time
+  static std::vector<MatchResult> matches(const std::vector<Arena*>& arenas,
+                                          MatchConfig config = {
+                                              .max_steps = 1000,
+                                              .training = true,
+                                          }) {
+    std::vector<MatchResult> results(arenas.size());
+    core::parallel::parallelFor(0, arenas.size(), 1,
+                                [&](auto first, auto last) {
+                                  for (auto i = first; i < last; ++i)
+                                    results[i] = arenas[i]->match(config);
+                                });
+    return results;
+  }
+
+  // Runs a full tournament in every arena at the same time
+  static std::vector<TournamentStats> tournaments(
+      const std::vector<Arena*>& arenas, TournamentConfig config) {
+    std::vector<TournamentStats> results(arenas.size());
+    core::parallel::parallelFor(0, arenas.size(), 1,
+                                [&](auto first, auto last) {
+                                  for (auto i = first; i < last; ++i)
+                                    results[i] = arenas[i]->tournament(config);
+                                });
+    return results;
+  }
 };
 }  // namespace talawa::arena
@@ -27,7 +27,8 @@ class DuelingHead : public talawa::nn::ILayer {
                   talawa::core::Initializer::GLOROT_UNIFORM);
   ~DuelingHead() = default;
 
-  virtual Matrix forward(const Matrix& input, bool is_training = true) override;
+  virtual Matrix forward(const ConstMatrixView& input,
+                         bool is_training = true) override;
   virtual Matrix backward(const Matrix& outputGradients) override;
   virtual std::vector<Matrix*> getParameters() override;
   virtual std::vector<Matrix*> getParameterGradients() override;
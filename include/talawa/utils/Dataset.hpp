@@ -12,9 +12,22 @@ class Dataset {
   Matrix features;  // Feature matrix (All samples)
   Matrix labels;    // Label matrix (One-Hot Encoded)
 
+  // A zero-copy mini-batch: both views point into the dataset itself
+  struct Batch {
+    ConstMatrixView features;
+    ConstMatrixView labels;
+  };
+
   Dataset() = default;
+  // Shuffles 'indices' only; splice() gathers rows through them
   void shuffle();
+  // Permutes the rows of features/labels in place (and resets 'indices'),
+  // so that every contiguous range is a random mini-batch for batch()
+  void shuffleRows();
+  // Gathers rows indices[start, end) into caller-owned matrices
   void splice(size_t start, size_t end, Matrix& features, Matrix& labels);
+  // Rows [start, end) in storage order, without copying
+  Batch batch(size_t start, size_t end) const;
   size_t size() const { return features.rows; }
 };
 
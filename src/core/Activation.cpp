@@ -1,12 +1,13 @@
 #include "talawa/core/Activation.hpp"
 
-#include <immintrin.h>
-
 #include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <stdexcept>
 
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Parallel.hpp"
+
 namespace talawa {
 namespace core {
 const float EPSILON = 1e-7f;
@@ -17,85 +18,118 @@ Activation::Activation(Type type) : type(type) {}
 // If this is 0.0, the gradient (y * error) becomes 0.0, killing the neuron.
 const float MIN_PROB = 1e-7f;
 
+namespace {
+// Elements per chunk; exp/tanh cost ~10x an add, so chunks are smaller
+// than for the plain element-wise kernels
+constexpr std::ptrdiff_t GRAIN = 1 << 12;
+
+// Formula: exp(x_i - max) / sum(exp(x_j - max)), clipped to EPSILON so
+// gradients keep flowing. Rows (batch items) are independent.
+void softmaxRows(const MatrixView& m) {
+  std::ptrdiff_t rows = m.rows, cols = m.cols;
+  if (rows * cols == 0) return;
+  const auto& k = kernels::active();
+  std::ptrdiff_t row_grain = std::max<std::ptrdiff_t>(1, GRAIN / cols);
+  parallel::parallelFor(0, rows, row_grain, [&](auto first, auto last) {
+    for (auto r = first; r < last; ++r) k.softmax(m.row(r), cols, EPSILON);
+  });
+}
+}  // namespace
+
 // --- Forward Pass (Apply) ---
 Matrix Activation::apply(const Matrix& z) const {
-  Matrix result = z;  // Copy dimensions
-  float* data = &result(0, 0);
-  size_t size = result.rows * result.cols;
+  Matrix result = z;
+  applyInPlace(result);
+  return result;
+}
+
+void Activation::applyInPlace(const MatrixView& z) const {
+  const auto& k = kernels::active();
+  void (*kernel)(float*, size_t) = nullptr;
 
   switch (type) {
     case LINEAR:
-      return result;  // Identity
-
-    case RELU: {
-      // f(x) = max(0, x) - Vectorized
-      __m256 zero_vec = _mm256_setzero_ps();
-      int main_limit = (size / 8) * 8;
-      for (int i = 0; i < main_limit; i += 8) {
-        __m256 x_vec = _mm256_loadu_ps(&data[i]);
-        __m256 result_vec = _mm256_max_ps(zero_vec, x_vec);
-        _mm256_storeu_ps(&data[i], result_vec);
-      }
-      for (int i = main_limit; i < size; ++i) {
-        data[i] = data[i] > 0.0f ? data[i] : 0.0f;
-      }
+      return;  // Identity
+
+    case RELU:
+      // f(x) = max(0, x)
+      kernel = k.relu;
       break;
-    }
 
     case SIGMOID:
       // f(x) = 1 / (1 + e^-x)
-      for (int i = 0; i < size; ++i) {
-        data[i] = 1.0f / (1.0f + std::exp(-data[i]));
-      }
+      kernel = k.sigmoid;
       break;
 
     case TANH:
       // f(x) = tanh(x)
-      for (int i = 0; i < size; ++i) {
-        data[i] = std::tanh(data[i]);
-      }
+      kernel = k.tanh;
       break;
 
-    case SOFTMAX: {
-      // Formula: exp(x_i) / sum(exp(x_j))
-      // Stabilization: exp(x_i - max_val) / sum(exp(x_j - max_val))
-
-      // Iterate Row by Row (Batch)
-      for (int r = 0; r < result.rows; ++r) {
-        float* row = &data[r * result.cols];
-        int cols = result.cols;
-
-        // 1. Find Max (for stability)
-        float max_val = row[0];
-        for (int c = 1; c < cols; ++c) {
-          if (row[c] > max_val) max_val = row[c];
-        }
+    case SOFTMAX:
+      softmaxRows(z);
+      return;
 
-        // 2. Exponentiate and Sum
-        float sum = 0.0f;
-        for (int c = 0; c < cols; ++c) {
-          float val = std::exp(row[c] - max_val);
-          row[c] = val;
-          sum += val;
-        }
+    case LOG_SOFTMAX:
+      throw std::runtime_error("Log-Softmax not implemented.");
+  }
 
-        // 3. Normalize
-        float inv_sum = 1.0f / sum;
-        for (int c = 0; c < cols; ++c) {
-          float prob = row[c] * inv_sum;
-          // Clip to EPSILON
-          if (prob < EPSILON) prob = EPSILON;
-          if (prob > 1.0f - EPSILON) prob = 1.0f - EPSILON;
-          row[c] = prob;
-        }
-      }
+  // Element-wise: one flat pass split across threads, or row by row
+  if (z.isContiguous()) {
+    float* data = z.rawData();
+    parallel::parallelFor(0, z.size(), GRAIN, [&](auto first, auto last) {
+      kernel(data + first, last - first);
+    });
+  } else {
+    std::ptrdiff_t row_grain =
+        std::max<std::ptrdiff_t>(1, GRAIN / std::max<size_t>(1, z.cols));
+    parallel::parallelFor(0, z.rows, row_grain, [&](auto first, auto last) {
+      for (auto r = first; r < last; ++r) kernel(z.row(r), z.cols);
+    });
+  }
+}
+
+gemm::Epilogue Activation::epilogue(const float* bias) const {
+  const auto& k = kernels::active();
+  gemm::Epilogue epilogue;
+  epilogue.bias = bias;
+  switch (type) {
+    case RELU:
+      epilogue.activation = k.relu;
       break;
-      case LOG_SOFTMAX: {
-        throw std::runtime_error("Log-Softmax not implemented.");
-      }
-    }
+    case SIGMOID:
+      epilogue.activation = k.sigmoid;
+      break;
+    case TANH:
+      epilogue.activation = k.tanh;
+      break;
+    default:
+      break;  // LINEAR: bias only. Softmax needs whole rows.
   }
-  return result;
+  return epilogue;
+}
+
+void Activation::applyAffine(const ConstMatrixView& x,
+                             const ConstMatrixView& w, const Matrix& bias,
+                             Matrix& out, Matrix* z) const {
+  if (type == LOG_SOFTMAX) {
+    throw std::runtime_error("Log-Softmax not implemented.");
+  }
+  if (bias.rows != 1 || bias.cols != w.cols) {
+    throw std::runtime_error("Bias must be a (1 x " + std::to_string(w.cols) +
+                             ") row.");
+  }
+  if (out.rows != x.rows || out.cols != w.cols) out = Matrix(x.rows, w.cols);
+
+  gemm::Epilogue fused = epilogue(bias.rawData());
+  if (z != nullptr) {
+    if (z->rows != x.rows || z->cols != w.cols) *z = Matrix(x.rows, w.cols);
+    fused.z = z->rawData();
+    fused.ldz = z->cols;
+  }
+
+  x.dot(w, out, fused);
+  if (!isElementwise()) applyInPlace(out);
 }
 
 void Activation::backprop(const Matrix& a, const Matrix& outputGradients,
@@ -107,116 +141,67 @@ void Activation::backprop(const Matrix& a, const Matrix& outputGradients,
   if (dZ.rows != a.rows || dZ.cols != a.cols) {
     dZ = Matrix(a.rows, a.cols);
   }
+  backprop(ConstMatrixView(a), ConstMatrixView(outputGradients),
+           MatrixView(dZ));
+}
 
+void Activation::backprop(const ConstMatrixView& a,
+                          const ConstMatrixView& outputGradients,
+                          const MatrixView& dZ) const {
   float* dZ_data = dZ.rawData();
   const float* a_data = a.rawData();
   const float* grad_data = outputGradients.rawData();
-  int size = a.rows * a.cols;
+  std::ptrdiff_t size = a.rows * a.cols;
+  const auto& k = kernels::active();
+
+  // Backward kernels are a few flops per element: bigger chunks
+  using Backward = void (*)(float*, const float*, const float*, size_t);
+  auto flat = [&](Backward kernel) {
+    parallel::parallelFor(0, size, 4 * GRAIN, [&](auto first, auto last) {
+      kernel(dZ_data + first, a_data + first, grad_data + first, last - first);
+    });
+  };
 
   switch (type) {
     case LINEAR:
       // dZ = dL/dA * 1 (pass through unchanged)
       std::memcpy(dZ_data, grad_data, size * sizeof(float));
       break;
-    case RELU: {
+    case RELU:
       // f'(x) = 1 if x > 0 else 0
-      __m256 zero_vec = _mm256_setzero_ps();
-      int main_limit = (size / 8) * 8;
-      for (int i = 0; i < main_limit; i += 8) {
-        __m256 a_vec = _mm256_loadu_ps(&a_data[i]);
-        __m256 g_vec = _mm256_loadu_ps(&grad_data[i]);
-        // Create mask: a > 0 ? all 1s : all 0s
-        __m256 mask = _mm256_cmp_ps(a_vec, zero_vec, _CMP_GT_OQ);
-        // Apply mask to gradient
-        __m256 result = _mm256_and_ps(mask, g_vec);
-        _mm256_storeu_ps(&dZ_data[i], result);
-      }
-      for (int i = main_limit; i < size; ++i) {
-        dZ_data[i] = a_data[i] > 0.0f ? grad_data[i] : 0.0f;
-      }
+      flat(k.relu_backward);
       break;
-    }
 
-    case SIGMOID: {
+    case SIGMOID:
       // f'(x) = f(x) * (1 - f(x))
-      __m256 one_vec = _mm256_set1_ps(1.0f);
-      int main_limit = (size / 8) * 8;
-      for (int i = 0; i < main_limit; i += 8) {
-        __m256 s_vec = _mm256_loadu_ps(&a_data[i]);
-        __m256 g_vec = _mm256_loadu_ps(&grad_data[i]);
-        // s * (1 - s) * grad
-        __m256 deriv = _mm256_mul_ps(s_vec, _mm256_sub_ps(one_vec, s_vec));
-        __m256 result = _mm256_mul_ps(deriv, g_vec);
-        _mm256_storeu_ps(&dZ_data[i], result);
-      }
-      for (int i = main_limit; i < size; ++i) {
-        float s = a_data[i];
-        dZ_data[i] = s * (1.0f - s) * grad_data[i];
-      }
+      flat(k.sigmoid_backward);
       break;
-    }
 
-    case TANH: {
+    case TANH:
       // f'(x) = 1 - tanh^2(x)
-      __m256 one_vec = _mm256_set1_ps(1.0f);
-      int main_limit = (size / 8) * 8;
-      for (int i = 0; i < main_limit; i += 8) {
-        __m256 t_vec = _mm256_loadu_ps(&a_data[i]);
-        __m256 g_vec = _mm256_loadu_ps(&grad_data[i]);
-        // (1 - t^2) * grad
-        __m256 t_sq = _mm256_mul_ps(t_vec, t_vec);
-        __m256 deriv = _mm256_sub_ps(one_vec, t_sq);
-        __m256 result = _mm256_mul_ps(deriv, g_vec);
-        _mm256_storeu_ps(&dZ_data[i], result);
-      }
-      for (int i = main_limit; i < size; ++i) {
-        float t = a_data[i];
-        dZ_data[i] = (1.0f - t * t) * grad_data[i];
-      }
+      flat(k.tanh_backward);
       break;
-    }
 
-    case SOFTMAX:
+    case SOFTMAX: {
       // --- Softmax Vector-Jacobian Product ---
       // Formula: dx_i = y_i * (grad_i - sum(y_k * grad_k))
-      for (int r = 0; r < outputGradients.rows; ++r) {
-        const float* a_row = &a_data[r * a.cols];
-        const float* g_row = &grad_data[r * outputGradients.cols];
-        float* dz_row = &dZ_data[r * dZ.cols];
-        int cols = outputGradients.cols;
-
-        // 1. Calculate Dot Product: sum(y_k * grad_k)
-        float dot = 0.0f;
-        int main_limit = (cols / 8) * 8;
-        __m256 dot_vec = _mm256_setzero_ps();
-        for (int c = 0; c < main_limit; c += 8) {
-          __m256 a_vec = _mm256_loadu_ps(&a_row[c]);
-          __m256 g_vec = _mm256_loadu_ps(&g_row[c]);
-          dot_vec = _mm256_fmadd_ps(a_vec, g_vec, dot_vec);
-        }
-        // Horizontal sum
-        float temp[8];
-        _mm256_storeu_ps(temp, dot_vec);
-        for (int x = 0; x < 8; ++x) dot += temp[x];
-        // Scalar cleanup
-        for (int c = main_limit; c < cols; ++c) {
-          dot += a_row[c] * g_row[c];
-        }
+      std::ptrdiff_t cols = a.cols;
+      if (size == 0) break;
+      std::ptrdiff_t row_grain = std::max<std::ptrdiff_t>(1, 4 * GRAIN / cols);
+      parallel::parallelFor(0, a.rows, row_grain, [&](auto first, auto last) {
+        for (auto r = first; r < last; ++r) {
+          const float* a_row = a_data + r * cols;
+          const float* g_row = grad_data + r * cols;
 
-        // 2. Apply formula: y * (g - dot)
-        __m256 dot_broadcast = _mm256_set1_ps(dot);
-        for (int c = 0; c < main_limit; c += 8) {
-          __m256 y_vec = _mm256_loadu_ps(&a_row[c]);
-          __m256 g_vec = _mm256_loadu_ps(&g_row[c]);
-          __m256 result =
-              _mm256_mul_ps(y_vec, _mm256_sub_ps(g_vec, dot_broadcast));
-          _mm256_storeu_ps(&dz_row[c], result);
-        }
-        for (int c = main_limit; c < cols; ++c) {
-          dz_row[c] = a_row[c] * (g_row[c] - dot);
+          // 1. Calculate Dot Product: sum(y_k * grad_k)
+          float dot = k.dot(a_row, g_row, cols);
+
+          // 2. Apply formula: y * (g - dot)
+          k.softmax_backward(dZ_data + r * cols, a_row, g_row, dot, cols);
         }
-      }
+      });
       break;
+    }
     default:
       throw std::runtime_error(
           "Backprop not defined for this activation type.");
@@ -0,0 +1,144 @@
+#include "talawa/core/Allocator.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace talawa {
+namespace core {
+namespace memory {
+
+namespace {
+size_t roundUp(size_t bytes, size_t multiple) {
+  return ((bytes + multiple - 1) / multiple) * multiple;
+}
+
+float* systemAlloc(size_t bytes) {
+  void* ptr = std::aligned_alloc(ALIGNMENT, bytes);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return static_cast<float*>(ptr);
+}
+}  // namespace
+
+// --- AlignedAllocator ---
+float* AlignedAllocator::allocate(size_t count, size_t& capacity) {
+  size_t bytes = roundUp(count * sizeof(float), ALIGNMENT);
+  capacity = bytes / sizeof(float);
+  return systemAlloc(bytes);
+}
+
+void AlignedAllocator::deallocate(float* ptr, size_t) { std::free(ptr); }
+
+// --- PoolAllocator ---
+PoolAllocator::PoolAllocator(size_t max_cached_bytes)
+    : max_cached_bytes_(max_cached_bytes) {}
+
+PoolAllocator::~PoolAllocator() { release(); }
+
+// Class c holds buffers of exactly (ALIGNMENT << c) bytes
+int PoolAllocator::sizeClass(size_t bytes) {
+  int c = 0;
+  size_t class_bytes = ALIGNMENT;
+  while (class_bytes < bytes) {
+    class_bytes <<= 1;
+    ++c;
+  }
+  return c;
+}
+
+float* PoolAllocator::allocate(size_t count, size_t& capacity) {
+  size_t bytes = count * sizeof(float);
+
+  if (bytes > MAX_POOLED_BYTES) {
+    misses_++;
+    bytes = roundUp(bytes, ALIGNMENT);
+    capacity = bytes / sizeof(float);
+    bytes_in_use_ += bytes;
+    return systemAlloc(bytes);
+  }
+
+  int c = sizeClass(bytes);
+  size_t class_bytes = ALIGNMENT << c;
+  capacity = class_bytes / sizeof(float);
+  bytes_in_use_ += class_bytes;
+
+  {
+    FreeList& list = classes_[c];
+    std::lock_guard<std::mutex> guard(list.lock);
+    if (!list.buffers.empty()) {
+      float* ptr = list.buffers.back();
+      list.buffers.pop_back();
+      bytes_held_ -= class_bytes;
+      hits_++;
+      return ptr;
+    }
+  }
+
+  misses_++;
+  return systemAlloc(class_bytes);
+}
+
+void PoolAllocator::deallocate(float* ptr, size_t capacity) {
+  size_t bytes = capacity * sizeof(float);
+  bytes_in_use_ -= bytes;
+
+  // Oversized buffers, or a full cache: give the memory back immediately
+  if (bytes > MAX_POOLED_BYTES ||
+      bytes_held_.load() + bytes > max_cached_bytes_.load()) {
+    std::free(ptr);
+    return;
+  }
+
+  FreeList& list = classes_[sizeClass(bytes)];
+  std::lock_guard<std::mutex> guard(list.lock);
+  list.buffers.push_back(ptr);
+  bytes_held_ += bytes;
+}
+
+PoolAllocator::Stats PoolAllocator::stats() const {
+  Stats s;
+  s.hits = hits_.load();
+  s.misses = misses_.load();
+  s.bytes_held = bytes_held_.load();
+  s.bytes_in_use = bytes_in_use_.load();
+  return s;
+}
+
+void PoolAllocator::resetStats() {
+  hits_ = 0;
+  misses_ = 0;
+}
+
+void PoolAllocator::release() {
+  for (int c = 0; c < NUM_CLASSES; ++c) {
+    FreeList& list = classes_[c];
+    std::lock_guard<std::mutex> guard(list.lock);
+    for (float* ptr : list.buffers) std::free(ptr);
+    bytes_held_ -= list.buffers.size() * (ALIGNMENT << c);
+    list.buffers.clear();
+  }
+}
+
+// --- Process-wide default ---
+// Intentionally leaked: static Matrices (e.g. Matrix::Empty) may be destroyed
+// after any function-local static, and must still find a live allocator.
+PoolAllocator& pool() {
+  static PoolAllocator* instance = new PoolAllocator();
+  return *instance;
+}
+
+namespace {
+std::atomic<IAllocator*> current_allocator{nullptr};
+}
+
+IAllocator& defaultAllocator() {
+  IAllocator* allocator = current_allocator.load(std::memory_order_acquire);
+  return allocator ? *allocator : pool();
+}
+
+void setDefaultAllocator(IAllocator* allocator) {
+  current_allocator.store(allocator, std::memory_order_release);
+}
+
+}  // namespace memory
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,102 @@
+#include "talawa/core/Cpu.hpp"
+
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace talawa {
+namespace core {
+namespace cpu {
+
+namespace {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+#define TALAWA_X86 1
+
+void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) {
+#if defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+  for (int i = 0; i < 4; ++i) regs[i] = static_cast<unsigned>(r[i]);
+#else
+  __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// Which register states the OS saves on context switch
+unsigned long long xgetbv0() {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  unsigned lo, hi;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return (static_cast<unsigned long long>(hi) << 32) | lo;
+#endif
+}
+#endif
+
+Features query() {
+  Features f;
+#ifdef TALAWA_X86
+  unsigned regs[4];  // eax, ebx, ecx, edx
+  cpuid(0, 0, regs);
+  unsigned max_leaf = regs[0];
+  if (max_leaf < 1) return f;
+
+  cpuid(1, 0, regs);
+  f.sse4_1 = regs[2] & (1u << 19);
+  bool osxsave = regs[2] & (1u << 27);
+  bool avx_hw = regs[2] & (1u << 28);
+  bool fma_hw = regs[2] & (1u << 12);
+
+  // 1. AVX needs the OS to save XMM (bit 1) and YMM (bit 2) state
+  unsigned long long xcr0 = osxsave ? xgetbv0() : 0;
+  bool ymm_enabled = (xcr0 & 0x6) == 0x6;
+  // 2. AVX-512 also needs opmask + upper ZMM state (bits 5, 6, 7)
+  bool zmm_enabled = (xcr0 & 0xE6) == 0xE6;
+
+  f.avx = avx_hw && ymm_enabled;
+  f.fma = fma_hw && ymm_enabled;
+
+  if (max_leaf >= 7) {
+    cpuid(7, 0, regs);
+    f.avx2 = (regs[1] & (1u << 5)) && ymm_enabled;
+    f.avx512f = (regs[1] & (1u << 16)) && zmm_enabled;
+  }
+#endif
+  return f;
+}
+}  // namespace
+
+const Features& features() {
+  static const Features f = query();
+  return f;
+}
+
+SimdLevel detectedLevel() {
+  const Features& f = features();
+  // Our AVX-512 kernels use FMA too; AVX2 kernels are always paired with FMA
+  if (f.avx512f && f.avx2 && f.fma) return SimdLevel::AVX512;
+  if (f.avx2 && f.fma) return SimdLevel::AVX2;
+  if (f.sse4_1) return SimdLevel::SSE4;
+  return SimdLevel::SCALAR;
+}
+
+std::string toString(SimdLevel level) {
+  switch (level) {
+    case SimdLevel::AVX512:
+      return "AVX-512";
+    case SimdLevel::AVX2:
+      return "AVX2+FMA";
+    case SimdLevel::SSE4:
+      return "SSE4.1";
+    default:
+      return "Scalar";
+  }
+}
+
+}  // namespace cpu
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,399 @@
+#include "talawa/core/Gemm.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Parallel.hpp"
+#include "talawa/core/Tuning.hpp"
+
+namespace talawa {
+namespace core {
+namespace gemm {
+
+namespace {
+
+// Growable, 64-byte aligned scratch buffer for packed panels.
+// One per thread (thread_local) so packing never hits the heap after warm-up.
+struct PackBuffer {
+  float* ptr = nullptr;
+  size_t capacity = 0;
+
+  ~PackBuffer() { std::free(ptr); }
+
+  float* get(size_t count) {
+    if (count > capacity) {
+      std::free(ptr);
+      size_t bytes = ((count * sizeof(float) + 63) / 64) * 64;
+      ptr = static_cast<float*>(std::aligned_alloc(64, bytes));
+      capacity = bytes / sizeof(float);
+    }
+    return ptr;
+  }
+};
+
+// --- PACKING ---
+// The register tile (MR x NR) comes from the active kernel table, so the
+// packing routines take it as a parameter.
+
+// A block (mc x kc) -> MR-row slivers, each stored k-major:
+//   packed[sliver * (MR * kc) + p * MR + r] = A(i + r, p)
+// Rows past 'mc' are zero-filled so the micro-kernel never branches.
+void packA(const Operand& A, int i0, int p0, int mc, int kc, int MR,
+           float* packed) {
+  for (int i = 0; i < mc; i += MR) {
+    int rows = std::min(MR, mc - i);
+    float* dst = packed + static_cast<size_t>(i) * kc;
+    const float* src = A.data + (i0 + i) * A.row_stride + p0 * A.col_stride;
+
+    if (A.row_stride == 1) {
+      // Transposed operand: the MR values for one p are contiguous
+      for (int p = 0; p < kc; ++p) {
+        const float* col = src + p * A.col_stride;
+        for (int r = 0; r < rows; ++r) dst[p * MR + r] = col[r];
+        for (int r = rows; r < MR; ++r) dst[p * MR + r] = 0.0f;
+      }
+    } else {
+      for (int r = 0; r < rows; ++r) {
+        const float* row = src + r * A.row_stride;
+        for (int p = 0; p < kc; ++p) dst[p * MR + r] = row[p * A.col_stride];
+      }
+      for (int r = rows; r < MR; ++r) {
+        for (int p = 0; p < kc; ++p) dst[p * MR + r] = 0.0f;
+      }
+    }
+  }
+}
+
+// Gathered A block: same layout, element runs read through G.read
+void packA(const Gathered& G, int i0, int p0, int mc, int kc, int MR,
+           float* packed) {
+  static thread_local PackBuffer rows_buffer;
+  if (G.transposed) {
+    // A(i, p) = R(p, i): one run of R per p covers the whole block
+    float* run = rows_buffer.get(mc);
+    for (int p = 0; p < kc; ++p) {
+      G.read(p0 + p, i0, mc, run);
+      for (int i = 0; i < mc; i += MR) {
+        int rows = std::min(MR, mc - i);
+        float* dst = packed + static_cast<size_t>(i) * kc + p * MR;
+        std::memcpy(dst, run + i, rows * sizeof(float));
+        for (int r = rows; r < MR; ++r) dst[r] = 0.0f;
+      }
+    }
+    return;
+  }
+
+  // A(i, p) = R(i, p): read a sliver's rows, then interleave them
+  float* rows_data = rows_buffer.get(static_cast<size_t>(MR) * kc);
+  for (int i = 0; i < mc; i += MR) {
+    int rows = std::min(MR, mc - i);
+    for (int r = 0; r < rows; ++r) {
+      G.read(i0 + i + r, p0, kc, rows_data + r * kc);
+    }
+    packA(Operand{rows_data, kc, 1}, 0, 0, rows, kc, MR,
+          packed + static_cast<size_t>(i) * kc);
+  }
+}
+
+// B block (kc x nc) -> NR-column slivers, each stored k-major:
+//   packed[sliver * (NR * kc) + p * NR + c] = B(p, j + c)
+void packB(const Operand& B, int p0, int j0, int kc, int nc, int NR,
+           float* packed) {
+  for (int j = 0; j < nc; j += NR) {
+    int cols = std::min(NR, nc - j);
+    float* dst = packed + static_cast<size_t>(j) * kc;
+    const float* src = B.data + p0 * B.row_stride + (j0 + j) * B.col_stride;
+
+    if (B.col_stride == 1 && cols == NR) {
+      // Row-major B, full sliver: straight row copies
+      for (int p = 0; p < kc; ++p) {
+        std::memcpy(dst + p * NR, src + p * B.row_stride, NR * sizeof(float));
+      }
+    } else if (B.col_stride == 1) {
+      for (int p = 0; p < kc; ++p) {
+        const float* row = src + p * B.row_stride;
+        for (int c = 0; c < cols; ++c) dst[p * NR + c] = row[c];
+        for (int c = cols; c < NR; ++c) dst[p * NR + c] = 0.0f;
+      }
+    } else {
+      for (int c = 0; c < cols; ++c) {
+        const float* col = src + c * B.col_stride;
+        for (int p = 0; p < kc; ++p) dst[p * NR + c] = col[p * B.row_stride];
+      }
+      for (int c = cols; c < NR; ++c) {
+        for (int p = 0; p < kc; ++p) dst[p * NR + c] = 0.0f;
+      }
+    }
+  }
+}
+
+// Gathered B block: same layout, element runs read through G.read
+void packB(const Gathered& G, int p0, int j0, int kc, int nc, int NR,
+           float* packed) {
+  static thread_local PackBuffer run_buffer;
+  if (G.transposed) {
+    // B(p, j) = R(j, p): one run of R per column
+    float* run = run_buffer.get(kc);
+    for (int j = 0; j < nc; j += NR) {
+      int cols = std::min(NR, nc - j);
+      float* dst = packed + static_cast<size_t>(j) * kc;
+      for (int c = 0; c < cols; ++c) {
+        G.read(j0 + j + c, p0, kc, run);
+        for (int p = 0; p < kc; ++p) dst[p * NR + c] = run[p];
+      }
+      for (int c = cols; c < NR; ++c) {
+        for (int p = 0; p < kc; ++p) dst[p * NR + c] = 0.0f;
+      }
+    }
+    return;
+  }
+
+  // B(p, j) = R(p, j): one run of R per row, split across the slivers
+  float* run = run_buffer.get(nc);
+  for (int p = 0; p < kc; ++p) {
+    G.read(p0 + p, j0, nc, run);
+    for (int j = 0; j < nc; j += NR) {
+      int cols = std::min(NR, nc - j);
+      float* dst = packed + static_cast<size_t>(j) * kc + p * NR;
+      std::memcpy(dst, run + j, cols * sizeof(float));
+      for (int c = cols; c < NR; ++c) dst[c] = 0.0f;
+    }
+  }
+}
+
+// Edge tiles: compute the full tile into a scratch buffer, then copy the
+// valid (rows x cols) corner into C.
+void microKernelEdge(const kernels::KernelTable& k, int kc, const float* A,
+                     const float* B, float* C, std::ptrdiff_t ldc,
+                     bool accumulate, int rows, int cols) {
+  alignas(64) float tile[MAX_MR * MAX_NR];
+  k.gemm_micro(kc, A, B, tile, k.nr, false);
+  for (int r = 0; r < rows; ++r) {
+    float* row = C + r * ldc;
+    const float* t = tile + r * k.nr;
+    if (accumulate) {
+      for (int c = 0; c < cols; ++c) row[c] += t[c];
+    } else {
+      for (int c = 0; c < cols; ++c) row[c] = t[c];
+    }
+  }
+}
+
+// Applies the epilogue to a finished (rows x cols) tile whose top-left
+// corner is (i, j) of the full output
+void finishTile(const kernels::KernelTable& k, const Epilogue& ep, float* C,
+                std::ptrdiff_t ldc, int i, int j, int rows, int cols) {
+  for (int r = 0; r < rows; ++r) {
+    float* row = C + r * ldc;
+    if (ep.bias != nullptr) k.add(row, ep.bias + j, cols);
+    if (ep.z != nullptr) {
+      std::memcpy(ep.z + (i + r) * ep.ldz + j, row, cols * sizeof(float));
+    }
+    if (ep.activation != nullptr) ep.activation(row, cols);
+  }
+}
+
+// Multiplies one packed A block (mc x kc) by one packed B panel (kc x nc).
+// 'ep' is only set for the last K slab; (i0, j0) locate C in the output.
+void macroKernel(const kernels::KernelTable& k, int mc, int nc, int kc,
+                 const float* packedA, const float* packedB, float* C,
+                 std::ptrdiff_t ldc, bool accumulate, const Epilogue* ep,
+                 int i0, int j0) {
+  const int MR = k.mr, NR = k.nr;
+  for (int j = 0; j < nc; j += NR) {
+    int cols = std::min(NR, nc - j);
+    const float* b_sliver = packedB + static_cast<size_t>(j) * kc;
+
+    for (int i = 0; i < mc; i += MR) {
+      int rows = std::min(MR, mc - i);
+      const float* a_sliver = packedA + static_cast<size_t>(i) * kc;
+      float* c_tile = C + i * ldc + j;
+
+      if (rows == MR && cols == NR) {
+        k.gemm_micro(kc, a_sliver, b_sliver, c_tile, ldc, accumulate);
+      } else {
+        microKernelEdge(k, kc, a_sliver, b_sliver, c_tile, ldc, accumulate,
+                        rows, cols);
+      }
+      if (ep != nullptr) {
+        finishTile(k, *ep, c_tile, ldc, i0 + i, j0 + j, rows, cols);
+      }
+    }
+  }
+}
+
+// Loops 3-5 of the packed GEMM. B panels come from 'packed' if given (laid
+// out by PackedB with the same KC/NC/NR), otherwise they are packed here.
+// Either operand may be an Operand or a Gathered.
+template <typename OperandA, typename OperandB = Operand>
+void run(int m, int n, int k, const OperandA& A, const OperandB* B,
+         const PackedB* packed, float* C, std::ptrdiff_t ldc, bool accumulate,
+         const Epilogue& epilogue) {
+  if (m <= 0 || n <= 0) return;
+  if (k <= 0) {
+    if (!accumulate) {
+      for (int i = 0; i < m; ++i) std::fill(C + i * ldc, C + i * ldc + n, 0.f);
+    }
+    if (!epilogue.empty()) {
+      finishTile(kernels::active(), epilogue, C, ldc, 0, 0, m, n);
+    }
+    return;
+  }
+
+  // Micro-kernel for this CPU (AVX-512 / AVX2 / SSE4 / scalar)
+  const kernels::KernelTable& kernel = kernels::active();
+  const int MR = kernel.mr, NR = kernel.nr;
+
+  // Blocking and threading for this host (defaults or the tuning file).
+  // Pre-packed operands fix KC and NC to what they were packed with.
+  const tuning::Config& tuned = tuning::current();
+  const int MC = std::max(MR, tuned.mc / MR * MR);
+  const int KC = packed ? packed->kc() : tuned.kc;
+  const int NC = packed ? packed->nc() : (tuned.nc + NR - 1) / NR * NR;
+
+  // Only pay the 'bureaucracy' cost of threads if the job is big enough
+  long long ops = static_cast<long long>(m) * n * k;
+  // Nested calls (e.g. inside a parallel rollout) may still split: the
+  // shared scheduler only hands the blocks to idle threads.
+  int num_threads = 1;
+  if (ops >= tuned.gemm_parallel_ops) {
+    num_threads = parallel::threadBudget();
+  }
+
+  // Shrink the row block for short-and-wide problems so every thread still
+  // gets at least one A block to work on.
+  int mc = MC;
+  if (num_threads > 1) {
+    int rows_per_thread = (m + num_threads - 1) / num_threads;
+    rows_per_thread = ((rows_per_thread + MR - 1) / MR) * MR;
+    mc = std::clamp(rows_per_thread, MR, MC);
+  }
+  int m_blocks = (m + mc - 1) / mc;
+  num_threads = std::min(num_threads, m_blocks);
+
+  static thread_local PackBuffer b_buffer;
+  float* b_scratch = nullptr;
+  if (!packed) {
+    b_scratch = b_buffer.get(static_cast<size_t>(std::min(k, KC)) *
+                             ((std::min(n, NC) + NR - 1) / NR * NR));
+  }
+
+  // Loop 5: columns of C / B in NC panels
+  for (int jc = 0; jc < n; jc += NC) {
+    int nc = std::min(NC, n - jc);
+
+    // Loop 4: the shared K dimension in KC slabs
+    for (int pc = 0; pc < k; pc += KC) {
+      int kc = std::min(KC, k - pc);
+      // Only the first K slab may overwrite C; the last one finishes it
+      bool acc = accumulate || pc > 0;
+      const Epilogue* ep =
+          pc + kc == k && !epilogue.empty() ? &epilogue : nullptr;
+
+      const float* packedB = b_scratch;
+      if (packed) {
+        packedB = packed->panel(jc, pc);
+      } else {
+        packB(*B, pc, jc, kc, nc, NR, b_scratch);
+      }
+
+      // Loop 3: rows of C / A in MC blocks, distributed across threads
+      auto rowBlocks = [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        static thread_local PackBuffer a_buffer;
+        for (auto block = first; block < last; ++block) {
+          int ic = static_cast<int>(block) * mc;
+          int rows = std::min(mc, m - ic);
+          float* packedA = a_buffer.get(static_cast<size_t>(kc) *
+                                        ((rows + MR - 1) / MR * MR));
+
+          packA(A, ic, pc, rows, kc, MR, packedA);
+          macroKernel(kernel, rows, nc, kc, packedA, packedB,
+                      C + ic * ldc + jc, ldc, acc, ep, ic, jc);
+        }
+      };
+      parallel::parallelFor(0, m_blocks, num_threads > 1 ? 1 : m_blocks,
+                            rowBlocks);
+    }
+  }
+}
+
+}  // namespace
+
+PackedB::PackedB(int k, int n, Operand B) : k_(k), n_(n) {
+  const kernels::KernelTable& kernel = kernels::active();
+  const tuning::Config& tuned = tuning::current();
+  nr_ = kernel.nr;
+  kc_ = tuned.kc;
+  nc_ = (tuned.nc + nr_ - 1) / nr_ * nr_;
+
+  // Panels in the order sgemm visits them: NC column panels, each split
+  // into KC slabs. Every panel is a multiple of NR floats, so all of them
+  // keep the 64-byte alignment of the buffer.
+  size_t total = 0;
+  for (int jc = 0; jc < n; jc += nc_) {
+    size_t width = (std::min(nc_, n - jc) + nr_ - 1) / nr_ * nr_;
+    for (int pc = 0; pc < k; pc += kc_) {
+      offsets_.push_back(total);
+      total += width * std::min(kc_, k - pc);
+    }
+  }
+  data_.resizeForOverwrite(total);
+
+  size_t panel = 0;
+  for (int jc = 0; jc < n; jc += nc_) {
+    for (int pc = 0; pc < k; pc += kc_) {
+      packB(B, pc, jc, std::min(kc_, k - pc), std::min(nc_, n - jc), nr_,
+            data_.data() + offsets_[panel++]);
+    }
+  }
+}
+
+const float* PackedB::panel(int jc, int pc) const {
+  int slabs = (k_ + kc_ - 1) / kc_;
+  return data_.data() + offsets_[(jc / nc_) * slabs + pc / kc_];
+}
+
+void sgemm(int m, int n, int k, Operand A, Operand B, float* C,
+           std::ptrdiff_t ldc, bool accumulate, const Epilogue& epilogue) {
+  run(m, n, k, A, &B, nullptr, C, ldc, accumulate, epilogue);
+}
+
+void sgemm(int m, int n, int k, const Gathered& A, Operand B, float* C,
+           std::ptrdiff_t ldc, bool accumulate, const Epilogue& epilogue) {
+  run(m, n, k, A, &B, nullptr, C, ldc, accumulate, epilogue);
+}
+
+void sgemm(int m, int n, int k, Operand A, const Gathered& B, float* C,
+           std::ptrdiff_t ldc, bool accumulate, const Epilogue& epilogue) {
+  run(m, n, k, A, &B, nullptr, C, ldc, accumulate, epilogue);
+}
+
+namespace {
+template <typename OperandA>
+void runPacked(int m, const OperandA& A, const PackedB& B, float* C,
+               std::ptrdiff_t ldc, bool accumulate, const Epilogue& epilogue) {
+  if (B.nr() != kernels::active().nr) {
+    throw std::runtime_error(
+        "PackedB was packed for a different SIMD tier; pack it again.");
+  }
+  const Operand* unpacked = nullptr;
+  run(m, B.cols(), B.rows(), A, unpacked, &B, C, ldc, accumulate, epilogue);
+}
+}  // namespace
+
+void sgemm(int m, Operand A, const PackedB& B, float* C, std::ptrdiff_t ldc,
+           bool accumulate, const Epilogue& epilogue) {
+  runPacked(m, A, B, C, ldc, accumulate, epilogue);
+}
+
+void sgemm(int m, const Gathered& A, const PackedB& B, float* C,
+           std::ptrdiff_t ldc, bool accumulate, const Epilogue& epilogue) {
+  runPacked(m, A, B, C, ldc, accumulate, epilogue);
+}
+
+}  // namespace gemm
+}  // namespace core
+}  // namespace talawa
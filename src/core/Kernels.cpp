@@ -0,0 +1,114 @@
+#include "talawa/core/Kernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+namespace talawa {
+namespace core {
+namespace kernels {
+
+// One fill() per tier, each defined in its own src/core/kernels/ TU
+namespace scalar {
+void fill(KernelTable& t);
+}
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define TALAWA_HAS_X86_KERNELS 1
+namespace sse4 {
+void fill(KernelTable& t);
+}
+namespace avx2 {
+void fill(KernelTable& t);
+}
+#if defined(__x86_64__) || defined(_M_X64)
+#define TALAWA_HAS_AVX512_KERNELS 1
+namespace avx512 {
+void fill(KernelTable& t);
+}
+#endif
+#endif
+
+namespace {
+// Highest tier we have kernels for on this architecture
+cpu::SimdLevel compiledLevel() {
+#if defined(TALAWA_HAS_AVX512_KERNELS)
+  return cpu::SimdLevel::AVX512;
+#elif defined(TALAWA_HAS_X86_KERNELS)
+  return cpu::SimdLevel::AVX2;
+#else
+  return cpu::SimdLevel::SCALAR;
+#endif
+}
+
+cpu::SimdLevel bestLevel() {
+  return std::min(cpu::detectedLevel(), compiledLevel());
+}
+
+KernelTable build(cpu::SimdLevel level) {
+  KernelTable t{};
+  switch (level) {
+#ifdef TALAWA_HAS_AVX512_KERNELS
+    case cpu::SimdLevel::AVX512:
+      avx512::fill(t);
+      break;
+#endif
+#ifdef TALAWA_HAS_X86_KERNELS
+    case cpu::SimdLevel::AVX2:
+      avx2::fill(t);
+      break;
+    case cpu::SimdLevel::SSE4:
+      sse4::fill(t);
+      break;
+#endif
+    default:
+      scalar::fill(t);
+  }
+  return t;
+}
+
+// Tiers above what the CPU supports are never built: even fill() is
+// compiled with that tier's flags and may use its instructions.
+const KernelTable& table(cpu::SimdLevel level) {
+  auto clamped = [](cpu::SimdLevel l) {
+    return build(std::min(l, bestLevel()));
+  };
+  static const KernelTable tables[] = {
+      clamped(cpu::SimdLevel::SCALAR), clamped(cpu::SimdLevel::SSE4),
+      clamped(cpu::SimdLevel::AVX2), clamped(cpu::SimdLevel::AVX512)};
+  return tables[static_cast<int>(std::min(level, bestLevel()))];
+}
+
+// TALAWA_SIMD=scalar|sse4|avx2|avx512 caps the tier (e.g. to reproduce a
+// result from an older node)
+cpu::SimdLevel startupLevel() {
+  const char* env = std::getenv("TALAWA_SIMD");
+  if (env == nullptr) return bestLevel();
+  std::string value(env);
+  if (value == "scalar") return cpu::SimdLevel::SCALAR;
+  if (value == "sse4") return cpu::SimdLevel::SSE4;
+  if (value == "avx2") return cpu::SimdLevel::AVX2;
+  return bestLevel();
+}
+
+std::atomic<const KernelTable*> current{nullptr};
+}  // namespace
+
+const KernelTable& active() {
+  const KernelTable* t = current.load(std::memory_order_acquire);
+  if (t == nullptr) {
+    t = &table(startupLevel());
+    current.store(t, std::memory_order_release);
+  }
+  return *t;
+}
+
+void force(cpu::SimdLevel level) {
+  current.store(&table(level), std::memory_order_release);
+}
+
+void reset() { current.store(&table(bestLevel()), std::memory_order_release); }
+
+}  // namespace kernels
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,213 @@
+#include "talawa/core/MatrixView.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+#include "talawa/core/Gemm.hpp"
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Matrix.hpp"
+#include "talawa/core/Parallel.hpp"
+
+// Views may start anywhere inside a buffer; the element-wise kernels
+// (core/Kernels.hpp) accept unaligned pointers.
+using namespace talawa::core;
+
+namespace {
+std::string shape(size_t rows, size_t cols) {
+  return "(" + std::to_string(rows) + "x" + std::to_string(cols) + ")";
+}
+
+// Strided operand descriptors for the packed GEMM engine: the row stride
+// is the view's stride, not its column count.
+gemm::Operand asOperand(const ConstMatrixView& v) {
+  return {v.rawData(), static_cast<std::ptrdiff_t>(v.stride), 1};
+}
+gemm::Operand asTransposedOperand(const ConstMatrixView& v) {
+  return {v.rawData(), 1, static_cast<std::ptrdiff_t>(v.stride)};
+}
+// Dots may run concurrently (e.g. parallel rollouts), so accumulate atomically
+void addDotTime(std::chrono::steady_clock::time_point t_start) {
+  std::atomic_ref<double>(Matrix::profiling_dot_time)
+      .fetch_add(std::chrono::duration_cast<std::chrono::duration<double>>(
+                     std::chrono::steady_clock::now() - t_start)
+                     .count(),
+                 std::memory_order_relaxed);
+}
+}  // namespace
+
+// --- ConstMatrixView ---
+ConstMatrixView ConstMatrixView::rowRange(size_t start_row,
+                                          size_t end_row) const {
+  if (start_row > end_row || end_row > rows) {
+    THROW_talawa_ERROR(MatrixView, "Row range [" << start_row << ", "
+                                                 << end_row
+                                                 << ") out of bounds for view "
+                                                 << shape(rows, cols));
+  }
+  return ConstMatrixView(data + start_row * stride, end_row - start_row, cols,
+                         stride);
+}
+
+ConstMatrixView ConstMatrixView::block(size_t row, size_t col, size_t num_rows,
+                                       size_t num_cols) const {
+  if (row + num_rows > rows || col + num_cols > cols) {
+    THROW_talawa_ERROR(MatrixView, "Block " << shape(num_rows, num_cols)
+                                            << " at (" << row << ", " << col
+                                            << ") out of bounds for view "
+                                            << shape(rows, cols));
+  }
+  return ConstMatrixView(data + row * stride + col, num_rows, num_cols,
+                         stride);
+}
+
+void ConstMatrixView::dot(const ConstMatrixView& B, const MatrixView& out,
+                          const gemm::Epilogue& epilogue) const {
+  auto t_start = std::chrono::steady_clock::now();
+  if (cols != B.rows || out.rows != rows || out.cols != B.cols) {
+    THROW_talawa_ERROR(MatrixView, "Dimension mismatch for dot product: "
+                                       << shape(rows, cols) << " . "
+                                       << shape(B.rows, B.cols) << " -> "
+                                       << shape(out.rows, out.cols));
+  }
+  gemm::sgemm(rows, B.cols, cols, asOperand(*this), asOperand(B),
+              out.rawData(), out.stride, false, epilogue);
+  addDotTime(t_start);
+}
+
+void ConstMatrixView::dotTN(const ConstMatrixView& B,
+                            const MatrixView& out) const {
+  auto t_start = std::chrono::steady_clock::now();
+  // this^T . B: both operands share their row count (the reduced dimension)
+  if (rows != B.rows || out.rows != cols || out.cols != B.cols) {
+    THROW_talawa_ERROR(MatrixView, "Dimension mismatch for dotTN: "
+                                       << shape(rows, cols) << "^T . "
+                                       << shape(B.rows, B.cols) << " -> "
+                                       << shape(out.rows, out.cols));
+  }
+  gemm::sgemm(cols, B.cols, rows, asTransposedOperand(*this), asOperand(B),
+              out.rawData(), out.stride);
+  addDotTime(t_start);
+}
+
+void ConstMatrixView::dotNT(const ConstMatrixView& B,
+                            const MatrixView& out) const {
+  auto t_start = std::chrono::steady_clock::now();
+  // this . B^T: both operands share their column count
+  if (cols != B.cols || out.rows != rows || out.cols != B.rows) {
+    THROW_talawa_ERROR(MatrixView, "Dimension mismatch for dotNT: "
+                                       << shape(rows, cols) << " . "
+                                       << shape(B.rows, B.cols) << "^T -> "
+                                       << shape(out.rows, out.cols));
+  }
+  gemm::sgemm(rows, B.rows, cols, asOperand(*this), asTransposedOperand(B),
+              out.rawData(), out.stride);
+  addDotTime(t_start);
+}
+
+void ConstMatrixView::reduceToRow(const MatrixView& out) const {
+  if (out.rows != 1 || out.cols != cols) {
+    THROW_talawa_ERROR(MatrixView, "Cannot sum the rows of "
+                                       << shape(rows, cols) << " into "
+                                       << shape(out.rows, out.cols));
+  }
+  const auto& k = kernels::active();
+  for (size_t r = 0; r < rows; ++r) k.add(out.rawData(), row(r), cols);
+}
+
+// --- MatrixView ---
+MatrixView MatrixView::rowRange(size_t start_row, size_t end_row) const {
+  if (start_row > end_row || end_row > rows) {
+    THROW_talawa_ERROR(MatrixView, "Row range [" << start_row << ", "
+                                                 << end_row
+                                                 << ") out of bounds for view "
+                                                 << shape(rows, cols));
+  }
+  return MatrixView(data + start_row * stride, end_row - start_row, cols,
+                    stride);
+}
+
+MatrixView MatrixView::block(size_t row, size_t col, size_t num_rows,
+                             size_t num_cols) const {
+  if (row + num_rows > rows || col + num_cols > cols) {
+    THROW_talawa_ERROR(MatrixView, "Block " << shape(num_rows, num_cols)
+                                            << " at (" << row << ", " << col
+                                            << ") out of bounds for view "
+                                            << shape(rows, cols));
+  }
+  return MatrixView(data + row * stride + col, num_rows, num_cols, stride);
+}
+
+void MatrixView::fill(float value) const {
+  if (isContiguous()) {
+    std::fill(data, data + size(), value);
+    return;
+  }
+  for (size_t r = 0; r < rows; ++r) std::fill(row(r), row(r) + cols, value);
+}
+
+void MatrixView::copyFrom(const ConstMatrixView& src) const {
+  if (src.rows != rows || src.cols != cols) {
+    THROW_talawa_ERROR(MatrixView, "Cannot copy " << shape(src.rows, src.cols)
+                                                  << " into "
+                                                  << shape(rows, cols));
+  }
+  if (isContiguous() && src.isContiguous()) {
+    std::memmove(data, src.rawData(), size() * sizeof(float));
+    return;
+  }
+  for (size_t r = 0; r < rows; ++r) {
+    std::memmove(row(r), src.row(r), cols * sizeof(float));
+  }
+}
+
+const MatrixView& MatrixView::operator+=(const ConstMatrixView& other) const {
+  // CASE 1: Same shape (a broadcast row is just a zero row stride)
+  // CASE 2: (1 x cols) row added to every row
+  size_t other_stride;
+  if (other.rows == rows && other.cols == cols) {
+    other_stride = other.stride;
+  } else if (other.rows == 1 && other.cols == cols) {
+    other_stride = 0;
+  } else {
+    THROW_talawa_ERROR(MatrixView, "Dimension mismatch for += operation: "
+                                       << shape(rows, cols) << " += "
+                                       << shape(other.rows, other.cols));
+  }
+
+  const auto& k = kernels::active();
+
+  // Below this many elements per chunk, threads cost more than they save
+  constexpr std::ptrdiff_t GRAIN = 1 << 14;
+
+  // Both sides contiguous: one flat pass over the whole buffer, split into
+  // large chunks across threads
+  if (other_stride != 0 && isContiguous() && other.isContiguous()) {
+    float* A = data;
+    const float* B = other.rawData();
+    parallel::parallelFor(0, size(), GRAIN, [&](auto begin, auto end) {
+      k.add(A + begin, B + begin, end - begin);
+    });
+    return *this;
+  }
+
+  std::ptrdiff_t row_grain = std::max<std::ptrdiff_t>(
+      1, GRAIN / std::max<std::ptrdiff_t>(1, cols));
+  parallel::parallelFor(0, rows, row_grain, [&](auto begin, auto end) {
+    for (auto i = begin; i < end; ++i) {
+      k.add(row(i), other.rawData() + i * other_stride, cols);
+    }
+  });
+  return *this;
+}
+
+const MatrixView& MatrixView::operator*=(float scalar) const {
+  const auto& k = kernels::active();
+  if (isContiguous()) {
+    k.scale(data, scalar, size());
+    return *this;
+  }
+  for (size_t r = 0; r < rows; ++r) k.scale(row(r), scalar, cols);
+  return *this;
+}
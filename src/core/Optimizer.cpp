@@ -1,153 +1,288 @@
 #include "talawa/core/Optimizer.hpp"
 
-#include <immintrin.h>
-
+#include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <mutex>
 #include <stdexcept>
 
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Parallel.hpp"
+
 namespace talawa {
 namespace core {
 
-SGD::SGD() {}
+namespace {
+// Elements per task: enough to amortise scheduling over a streaming pass
+constexpr std::ptrdiff_t GRAIN = 1 << 15;
 
-void SGD::update(const std::vector<Matrix*>& params,
-                 const std::vector<Matrix*>& grads) {
-  // Sanity check: We must have exactly one gradient matrix for every parameter
-  // matrix
+// Sanity check: We must have exactly one gradient matrix, of the same size,
+// for every parameter matrix
+void checkGradients(const std::vector<Matrix*>& params,
+                    const std::vector<Matrix*>& grads) {
   if (params.size() != grads.size()) {
     throw std::runtime_error("Optimizer Mismatch: Parameter count (" +
                              std::to_string(params.size()) +
                              ") does not match Gradient count (" +
                              std::to_string(grads.size()) + ").");
   }
-
-  float lr = this->get_learning_rate();
-  __m256 lr_vec = _mm256_set1_ps(lr);
-
-  // Iterate over all layers' parameters (weights and biases)
   for (size_t i = 0; i < params.size(); ++i) {
-    Matrix* param = params[i];
-    Matrix* grad = grads[i];
+    if (params[i]->size() != grads[i]->size()) {
+      throw std::runtime_error("Optimizer Mismatch: Parameter " +
+                               std::to_string(i) + " has " +
+                               std::to_string(params[i]->size()) +
+                               " elements but its gradient has " +
+                               std::to_string(grads[i]->size()) + ".");
+    }
+  }
+}
 
-    float* P = param->rawData();
-    const float* G = grad->rawData();
-    int size = param->rows * param->cols;
-    int main_loop_limit = (size / 8) * 8;
+// Zero state matching each parameter's shape, built on first use
+void initState(std::vector<Matrix>& state, const std::vector<Matrix*>& params) {
+  if (!state.empty()) return;
+  state.reserve(params.size());
+  for (const auto* p : params) state.push_back(Matrix::zeros(p->rows, p->cols));
+}
 
-    // AVX2 vectorized: W = W - lr * dW
-    for (int j = 0; j < main_loop_limit; j += 8) {
-      __m256 p_vec = _mm256_loadu_ps(&P[j]);
-      __m256 g_vec = _mm256_loadu_ps(&G[j]);
+// The multi-tensor engine: the elements of tensors [first, last) form one
+// flat range that is split evenly across the thread pool, so the work per
+// thread does not depend on how the parameters are divided into matrices
+// (one arena or hundreds of small tensors). fn(i, begin, end) updates
+// elements [begin, end) of tensor i with a single fused kernel call. With
+// block > 1, slices only start on multiples of `block` within a tensor.
+template <typename F>
+void forEachSlice(const std::vector<Matrix*>& params, size_t first,
+                  size_t last, F&& fn, size_t block = 1) {
+  // Offsets count blocks, so every split point lands on a block boundary
+  std::vector<size_t> offsets(last - first + 1, 0);
+  for (size_t i = first; i < last; ++i) {
+    offsets[i - first + 1] =
+        offsets[i - first] + (params[i]->size() + block - 1) / block;
+  }
+  std::ptrdiff_t grain = std::max<std::ptrdiff_t>(GRAIN / block, 1);
 
-      __m256 update = _mm256_fnmadd_ps(lr_vec, g_vec, p_vec);  // p - lr*g
-      _mm256_storeu_ps(&P[j], update);
-    }
-    // Scalar cleanup
-    for (int j = main_loop_limit; j < size; ++j) {
-      P[j] -= lr * G[j];
+  parallel::parallelFor(0, offsets.back(), grain, [&](auto lo_, auto hi_) {
+    size_t lo = lo_, hi = hi_;
+    size_t j = std::upper_bound(offsets.begin(), offsets.end(), lo) -
+               offsets.begin() - 1;
+    for (; j < last - first && offsets[j] < hi; ++j) {
+      size_t begin = (std::max(lo, offsets[j]) - offsets[j]) * block;
+      size_t end = std::min((std::min(hi, offsets[j + 1]) - offsets[j]) * block,
+                            params[first + j]->size());
+      if (end > begin) fn(first + j, begin, end);
     }
-  }
+  });
 }
 
-Adam::Adam(float beta1, float beta2, float eps)
-    : beta1(beta1), beta2(beta2), epsilon(eps), t(0) {}
+// Scales all gradients down so their global L2 norm is at most max_norm
+void clipGradients(const std::vector<Matrix*>& grads, float max_norm) {
+  const auto& k = kernels::active();
 
-void Adam::update(const std::vector<Matrix*>& params,
-                  const std::vector<Matrix*>& grads) {
-  if (params.size() != grads.size()) {
+  // 1. Global norm: one partial sum per slice
+  std::mutex lock;
+  double squares = 0.0;
+  forEachSlice(grads, 0, grads.size(), [&](size_t i, size_t first,
+                                           size_t last) {
+    const float* g = grads[i]->rawData() + first;
+    double partial = k.dot(g, g, last - first);
+    std::lock_guard<std::mutex> guard(lock);
+    squares += partial;
+  });
+
+  // 2. Rescale
+  double norm = std::sqrt(squares);
+  if (norm <= max_norm) return;
+  float factor = static_cast<float>(max_norm / norm);
+  forEachSlice(grads, 0, grads.size(), [&](size_t i, size_t first,
+                                           size_t last) {
+    k.scale(grads[i]->rawData() + first, factor, last - first);
+  });
+}
+
+template <typename T>
+size_t bytesOf(const std::vector<std::vector<T>>& state) {
+  size_t bytes = 0;
+  for (const auto& s : state) bytes += s.size() * sizeof(T);
+  return bytes;
+}
+
+size_t bytesOf(const std::vector<Matrix>& state) {
+  size_t bytes = 0;
+  for (const auto& s : state) bytes += s.size() * sizeof(float);
+  return bytes;
+}
+
+// Adam's per-step scalars with the bias corrections folded in (see
+// kernels::AdamStep)
+kernels::AdamStep adamStep(float lr, float beta1, float beta2, float epsilon,
+                           float weight_decay, int t) {
+  float step = static_cast<float>(t);
+  float correction_m = 1.0f - std::pow(beta1, step);
+  float sqrt_correction_v = std::sqrt(1.0f - std::pow(beta2, step));
+  return {beta1, beta2, lr * sqrt_correction_v / correction_m,
+          epsilon * sqrt_correction_v, 1.0f - lr * weight_decay};
+}
+}  // namespace
+
+void Optimizer::update(const std::vector<Matrix*>& params,
+                       const std::vector<Matrix*>& grads) {
+  checkGradients(params, grads);
+  if (max_grad_norm > 0.0f) clipGradients(grads, max_grad_norm);
+  startStep(params);
+  updateTensors(params, grads, 0, params.size());
+}
+
+void Optimizer::beginStep(const std::vector<Matrix*>& params,
+                          const std::vector<Matrix*>& grads) {
+  if (!canSplitSteps()) {
     throw std::runtime_error(
-        "Optimizer Mismatch: Params/Grads count mismatch.");
+        "Optimizer: gradient clipping needs every gradient, so its steps "
+        "cannot be split.");
   }
+  checkGradients(params, grads);
+  startStep(params);
+}
+
+SGD::SGD() {}
+
+void SGD::updateTensors(const std::vector<Matrix*>& params,
+                        const std::vector<Matrix*>& grads, size_t first,
+                        size_t last) {
+  float lr = this->get_learning_rate();
+  const auto& k = kernels::active();
 
+  // W = W - lr * dW
+  forEachSlice(params, first, last, [&](size_t i, size_t lo, size_t hi) {
+    k.sgd_update(params[i]->rawData() + lo, grads[i]->rawData() + lo, lr,
+                 hi - lo);
+  });
+}
+
+MomentumSGD::MomentumSGD(float momentum) : momentum(momentum) {}
+
+size_t MomentumSGD::stateBytes() const { return bytesOf(velocity); }
+
+void MomentumSGD::startStep(const std::vector<Matrix*>& params) {
+  initState(velocity, params);
+}
+
+void MomentumSGD::updateTensors(const std::vector<Matrix*>& params,
+                                const std::vector<Matrix*>& grads,
+                                size_t first, size_t last) {
+  float lr = this->get_learning_rate();
+  const auto& k = kernels::active();
+
+  // V = momentum * V + dW;  W = W - lr * V
+  forEachSlice(params, first, last, [&](size_t i, size_t lo, size_t hi) {
+    k.sgd_momentum_update(params[i]->rawData() + lo, grads[i]->rawData() + lo,
+                          velocity[i].rawData() + lo, lr, momentum, hi - lo);
+  });
+}
+
+Adam::Adam(float beta1, float beta2, float eps)
+    : beta1(beta1), beta2(beta2), epsilon(eps), t(0) {}
+
+void Adam::startStep(const std::vector<Matrix*>& params) {
   // 1. Initialize State Caches on first run
-  if (m_cache.empty()) {
-    m_cache.reserve(params.size());
-    v_cache.reserve(params.size());
-    for (const auto* p : params) {
-      // Create zero matrices matching parameter shapes
-      m_cache.push_back(Matrix::zeros(p->rows, p->cols));
-      v_cache.push_back(Matrix::zeros(p->rows, p->cols));
-    }
-  }
+  initState(m_cache, params);
+  initState(v_cache, params);
 
   // 2. Increment Time Step
   t++;
+}
 
-  // 3. Calculate Bias Corrections
-  float correction_m = 1.0f / (1.0f - std::pow(beta1, t));
-  float correction_v = 1.0f / (1.0f - std::pow(beta2, t));
-
-  // Pre-compute constants for AVX
-  __m256 beta1_vec = _mm256_set1_ps(beta1);
-  __m256 beta2_vec = _mm256_set1_ps(beta2);
-  __m256 one_minus_beta1_vec = _mm256_set1_ps(1.0f - beta1);
-  __m256 one_minus_beta2_vec = _mm256_set1_ps(1.0f - beta2);
-  __m256 correction_m_vec = _mm256_set1_ps(correction_m);
-  __m256 correction_v_vec = _mm256_set1_ps(correction_v);
-  __m256 lr_vec = _mm256_set1_ps(this->get_learning_rate());
-  __m256 eps_vec = _mm256_set1_ps(epsilon);
+void Adam::updateTensors(const std::vector<Matrix*>& params,
+                         const std::vector<Matrix*>& grads, size_t first,
+                         size_t last) {
+  // 3. Fold the bias corrections into two scalars (see kernels::AdamStep),
+  // so the per-element update needs no division
+  kernels::AdamStep step = adamStep(this->get_learning_rate(), beta1, beta2,
+                                    epsilon, weight_decay, t);
+  const auto& k = kernels::active();
 
   // 4. Update Parameters
-  for (size_t i = 0; i < params.size(); ++i) {
-    float* P = params[i]->rawData();
-    const float* G = grads[i]->rawData();
-    float* M = m_cache[i].rawData();
-    float* V = v_cache[i].rawData();
-
-    int size = params[i]->rows * params[i]->cols;
-    int main_loop_limit = (size / 8) * 8;
-
-    // AVX2 vectorized Adam update
-    for (int j = 0; j < main_loop_limit; j += 8) {
-      __m256 g_vec = _mm256_loadu_ps(&G[j]);
-      __m256 m_vec = _mm256_loadu_ps(&M[j]);
-      __m256 v_vec = _mm256_loadu_ps(&V[j]);
-      __m256 p_vec = _mm256_loadu_ps(&P[j]);
-
-      // m = beta1 * m + (1 - beta1) * g
-      m_vec = _mm256_fmadd_ps(beta1_vec, m_vec,
-                              _mm256_mul_ps(one_minus_beta1_vec, g_vec));
-
-      // v = beta2 * v + (1 - beta2) * g^2
-      __m256 g_sq = _mm256_mul_ps(g_vec, g_vec);
-      v_vec = _mm256_fmadd_ps(beta2_vec, v_vec,
-                              _mm256_mul_ps(one_minus_beta2_vec, g_sq));
-
-      // Store updated m and v
-      _mm256_storeu_ps(&M[j], m_vec);
-      _mm256_storeu_ps(&V[j], v_vec);
-
-      // m_hat = m * correction_m, v_hat = v * correction_v
-      __m256 m_hat = _mm256_mul_ps(m_vec, correction_m_vec);
-      __m256 v_hat = _mm256_mul_ps(v_vec, correction_v_vec);
-
-      // theta = theta - lr * m_hat / (sqrt(v_hat) + epsilon)
-      __m256 denom = _mm256_add_ps(_mm256_sqrt_ps(v_hat), eps_vec);
-      __m256 update = _mm256_div_ps(_mm256_mul_ps(lr_vec, m_hat), denom);
-      p_vec = _mm256_sub_ps(p_vec, update);
-
-      _mm256_storeu_ps(&P[j], p_vec);
-    }
-
-    // Scalar cleanup for remaining elements
-    for (int j = main_loop_limit; j < size; ++j) {
-      auto g = G[j];
+  // m = beta1 * m + (1 - beta1) * g
+  // v = beta2 * v + (1 - beta2) * g^2
+  // theta = theta * decay - lr * m_hat / (sqrt(v_hat) + epsilon)
+  forEachSlice(params, first, last, [&](size_t i, size_t lo, size_t hi) {
+    k.adam_update(params[i]->rawData() + lo, grads[i]->rawData() + lo,
+                  m_cache[i].rawData() + lo, v_cache[i].rawData() + lo, step,
+                  hi - lo);
+  });
+}
 
-      // Update biased first moment (Momentum)
-      M[j] = beta1 * M[j] + (1.0f - beta1) * g;
+size_t Adam::stateBytes() const { return bytesOf(m_cache) + bytesOf(v_cache); }
 
-      // Update biased second raw moment (Velocity)
-      V[j] = beta2 * V[j] + (1.0f - beta2) * g * g;
+AdamW::AdamW(float weight_decay, float beta1, float beta2, float epsilon)
+    : Adam(beta1, beta2, epsilon) {
+  this->weight_decay = weight_decay;
+}
 
-      // Compute bias-corrected moments
-      float m_hat = M[j] * correction_m;
-      float v_hat = V[j] * correction_v;
+QuantizedAdam::QuantizedAdam(MomentPrecision precision, float beta1,
+                             float beta2, float epsilon)
+    : Adam(beta1, beta2, epsilon), precision(precision) {}
 
-      // Update Parameter
-      P[j] -= this->get_learning_rate() * m_hat / (std::sqrt(v_hat) + epsilon);
+void QuantizedAdam::startStep(const std::vector<Matrix*>& params) {
+  t++;
+  if (elements > 0) return;
+  for (const auto* p : params) {
+    size_t n = p->size();
+    elements += n;
+    if (precision == MomentPrecision::BF16) {
+      m16.emplace_back(n, 0);
+      v16.emplace_back(n, 0);
+    } else {
+      size_t blocks = (n + kernels::Q8_BLOCK - 1) / kernels::Q8_BLOCK;
+      m8.emplace_back(n, 0);
+      v8.emplace_back(n, 0);
+      m_scales.emplace_back(blocks, 0.0f);
+      v_scales.emplace_back(blocks, 0.0f);
     }
   }
 }
 
+void QuantizedAdam::updateTensors(const std::vector<Matrix*>& params,
+                                  const std::vector<Matrix*>& grads,
+                                  size_t first, size_t last) {
+  kernels::AdamStep step = adamStep(this->get_learning_rate(), beta1, beta2,
+                                    epsilon, weight_decay, t);
+  const auto& k = kernels::active();
+
+  // Rounding noise depends on the step and the element only, so results do
+  // not change with the thread count
+  auto seed = [&](size_t i, size_t lo) {
+    return static_cast<uint32_t>(t) * 0x9e3779b9u +
+           static_cast<uint32_t>(i) * 0x85ebca6bu + static_cast<uint32_t>(lo);
+  };
+
+  if (precision == MomentPrecision::BF16) {
+    forEachSlice(params, first, last, [&](size_t i, size_t lo, size_t hi) {
+      k.adam_update_bf16(params[i]->rawData() + lo, grads[i]->rawData() + lo,
+                         m16[i].data() + lo, v16[i].data() + lo, step,
+                         seed(i, lo), hi - lo);
+    });
+    return;
+  }
+
+  // Slices start on block boundaries, so each block's scales are only
+  // touched by one thread
+  forEachSlice(
+      params, first, last,
+      [&](size_t i, size_t lo, size_t hi) {
+        size_t block = lo / kernels::Q8_BLOCK;
+        k.adam_update_q8(params[i]->rawData() + lo, grads[i]->rawData() + lo,
+                         m8[i].data() + lo, v8[i].data() + lo,
+                         m_scales[i].data() + block,
+                         v_scales[i].data() + block, step, seed(i, lo),
+                         hi - lo);
+      },
+      kernels::Q8_BLOCK);
+}
+
+size_t QuantizedAdam::stateBytes() const {
+  return bytesOf(m16) + bytesOf(v16) + bytesOf(m8) + bytesOf(v8) +
+         bytesOf(m_scales) + bytesOf(v_scales);
+}
+
 }  // namespace core
 }  // namespace talawa
@@ -0,0 +1,273 @@
+#include "talawa/core/Parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "talawa/core/Tuning.hpp"
+
+namespace talawa {
+namespace core {
+namespace parallel {
+
+namespace {
+
+constexpr int MAX_THREADS = 256;
+
+// One parallelFor call. Lives on the caller's stack; chunks are claimed
+// with an atomic cursor by the caller and by any worker that steals it.
+struct Job {
+  detail::ChunkFn fn;
+  void* ctx;
+  std::ptrdiff_t end;
+  std::ptrdiff_t chunk;
+  std::atomic<std::ptrdiff_t> next;
+  std::atomic<std::ptrdiff_t> remaining;  // Chunks not finished yet
+  std::atomic<int> visitors{0};           // Thieves currently inside work()
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+
+  bool exhausted() const {
+    return next.load(std::memory_order_relaxed) >= end;
+  }
+};
+
+// Nesting depth of parallelFor bodies on this thread
+thread_local int depth = 0;
+
+struct DepthGuard {
+  DepthGuard() { ++depth; }
+  ~DepthGuard() { --depth; }
+};
+
+// Claims and runs chunks until none are left
+void work(Job& job) {
+  while (true) {
+    std::ptrdiff_t lo =
+        job.next.fetch_add(job.chunk, std::memory_order_relaxed);
+    if (lo >= job.end) return;
+    std::ptrdiff_t hi = std::min(lo + job.chunk, job.end);
+
+    if (!job.failed.load(std::memory_order_relaxed)) {
+      DepthGuard guard;
+      try {
+        job.fn(job.ctx, lo, hi);
+      } catch (...) {
+        bool expected = false;
+        if (job.failed.compare_exchange_strong(expected, true)) {
+          job.error = std::current_exception();
+        }
+      }
+    }
+    job.remaining.fetch_sub(1, std::memory_order_acq_rel);
+  }
+}
+
+// Jobs pushed by one thread. The owner takes from the back (its most
+// recent, innermost loop); thieves take from the front (the oldest, and
+// usually the largest, piece of work).
+struct Deque {
+  std::mutex mutex;
+  std::deque<Job*> jobs;
+
+  void push(Job* job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(job);
+  }
+
+  void remove(Job* job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find(jobs.rbegin(), jobs.rend(), job);
+    if (it != jobs.rend()) jobs.erase(std::next(it).base());
+  }
+
+  // Registers the caller as a visitor while the lock still pins the job
+  Job* take(bool from_back) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto visit = [](Job* job) {
+      job->visitors.fetch_add(1, std::memory_order_acq_rel);
+      return job;
+    };
+    if (from_back) {
+      for (auto it = jobs.rbegin(); it != jobs.rend(); ++it)
+        if (!(*it)->exhausted()) return visit(*it);
+    } else {
+      for (Job* job : jobs)
+        if (!job->exhausted()) return visit(job);
+    }
+    return nullptr;
+  }
+};
+
+// The worker deque of the current thread (null on non-worker threads)
+thread_local Deque* self = nullptr;
+
+class Pool {
+ public:
+  ~Pool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    sleep_cv_.notify_all();
+    for (auto& t : threads_) t.join();
+  }
+
+  // Non-worker threads share one deque
+  Deque& dequeFor() { return self != nullptr ? *self : external_; }
+
+  // Lets the first 'count' workers take jobs, spawning any that are missing
+  void setWorkers(int count) {
+    count = std::clamp(count, 0, MAX_THREADS);
+    participating_.store(count, std::memory_order_relaxed);
+    if (spawned_.load(std::memory_order_acquire) >= count) return;
+
+    std::lock_guard<std::mutex> lock(spawn_mutex_);
+    while (static_cast<int>(threads_.size()) < count) {
+      int index = static_cast<int>(threads_.size());
+      threads_.emplace_back([this, index] { workerLoop(index); });
+    }
+    spawned_.store(count, std::memory_order_release);
+  }
+
+  void notify() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      ++epoch_;
+    }
+    sleep_cv_.notify_all();
+  }
+
+ private:
+  Job* steal(int index) {
+    // 1. Own deque first: nested loops pushed by the job we are helping
+    if (Job* job = deques_[index].take(true)) return job;
+
+    // 2. Other workers, starting after ourselves so thieves spread out
+    int n = spawned_.load(std::memory_order_acquire);
+    for (int i = 1; i < n; ++i) {
+      if (Job* job = deques_[(index + i) % n].take(false)) return job;
+    }
+
+    // 3. Loops started by non-worker threads
+    return external_.take(false);
+  }
+
+  void workerLoop(int index) {
+    self = &deques_[index];
+    while (true) {
+      std::uint64_t seen;
+      {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        if (stop_) return;
+        seen = epoch_;
+      }
+
+      // Workers beyond the budget stay asleep
+      if (index < participating_.load(std::memory_order_relaxed)) {
+        if (Job* job = steal(index)) {
+          work(*job);
+          job->visitors.fetch_sub(1, std::memory_order_acq_rel);
+          continue;
+        }
+      }
+
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      sleep_cv_.wait(lock, [&] { return stop_ || epoch_ != seen; });
+    }
+  }
+
+  std::array<Deque, MAX_THREADS> deques_;
+  Deque external_;
+
+  std::mutex spawn_mutex_;
+  std::vector<std::thread> threads_;
+  std::atomic<int> spawned_{0};
+  std::atomic<int> participating_{0};
+
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  std::uint64_t epoch_ = 0;
+  bool stop_ = false;
+};
+
+Pool& pool() {
+  static Pool instance;
+  return instance;
+}
+
+std::atomic<int> budget_override{0};
+
+}  // namespace
+
+int threadBudget() {
+  int forced = budget_override.load(std::memory_order_relaxed);
+  int budget = forced > 0 ? forced : tuning::current().threads();
+  return std::clamp(budget, 1, MAX_THREADS);
+}
+
+void setThreadBudget(int threads) {
+  budget_override.store(std::max(0, threads), std::memory_order_relaxed);
+}
+
+bool inParallel() { return depth > 0; }
+
+namespace detail {
+
+void run(std::ptrdiff_t begin, std::ptrdiff_t end, std::ptrdiff_t grain,
+         ChunkFn fn, void* ctx) {
+  std::ptrdiff_t n = end - begin;
+  if (n <= 0) return;
+  grain = std::max<std::ptrdiff_t>(grain, 1);
+
+  int budget = threadBudget();
+  if (budget <= 1 || n <= grain) {
+    DepthGuard guard;
+    fn(ctx, begin, end);
+    return;
+  }
+
+  // ~4 chunks per thread evens out uneven chunks without much overhead
+  std::ptrdiff_t target = static_cast<std::ptrdiff_t>(budget) * 4;
+  std::ptrdiff_t chunk = std::max(grain, (n + target - 1) / target);
+
+  Job job;
+  job.fn = fn;
+  job.ctx = ctx;
+  job.end = end;
+  job.chunk = chunk;
+  job.next.store(begin, std::memory_order_relaxed);
+  job.remaining.store((n + chunk - 1) / chunk, std::memory_order_relaxed);
+
+  Pool& p = pool();
+  p.setWorkers(budget - 1);
+  Deque& deque = p.dequeFor();
+  deque.push(&job);
+  p.notify();
+
+  // Work on our own loop, then wait for the chunks thieves took. We do not
+  // run other jobs while waiting: the caller may hold per-thread scratch
+  // (e.g. GEMM pack buffers) that another job would clobber.
+  work(job);
+  deque.remove(&job);
+  while (job.remaining.load(std::memory_order_acquire) > 0 ||
+         job.visitors.load(std::memory_order_acquire) > 0) {
+    std::this_thread::yield();
+  }
+
+  if (job.error) std::rethrow_exception(job.error);
+}
+
+}  // namespace detail
+
+}  // namespace parallel
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,290 @@
+#include "talawa/core/Tuning.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "talawa/core/Cpu.hpp"
+#include "talawa/core/Matrix.hpp"
+
+namespace talawa {
+namespace core {
+namespace tuning {
+
+namespace {
+int hardwareThreads() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Identifies the machine a tuning file was measured on
+std::string hostKey() {
+  return cpu::toString(cpu::detectedLevel()) + ", " +
+         std::to_string(hardwareThreads()) + " threads";
+}
+
+Config sanitize(Config c) {
+  c.mc = std::clamp(c.mc, 12, 4096);
+  c.kc = std::clamp(c.kc, 16, 4096);
+  c.nc = std::clamp(c.nc, 32, 1 << 16);
+  c.gemm_parallel_ops = std::max(0LL, c.gemm_parallel_ops);
+  c.max_threads = std::clamp(c.max_threads, 0, hardwareThreads());
+  c.transpose_block = std::clamp(c.transpose_block, 4, 1024);
+  c.transpose_parallel_elems = std::max(0LL, c.transpose_parallel_elems);
+  return c;
+}
+
+Config startupConfig() {
+  if (auto loaded = load()) return *loaded;
+
+  const char* env = std::getenv("TALAWA_AUTOTUNE");
+  if (env != nullptr && std::string(env) == "1") {
+    Config tuned = autotune();
+    if (!save(tuned)) {
+      std::cerr << "[Tuning] Could not write " << defaultPath() << std::endl;
+    }
+    return tuned;
+  }
+  return Config{};
+}
+
+Config& active() {
+  static Config config;
+  static std::once_flag once;
+  // Autotuning at startup runs GEMMs, which read the config again: those
+  // nested calls see the defaults instead of re-entering the initialiser.
+  static thread_local bool initializing = false;
+  if (!initializing) {
+    std::call_once(once, [] {
+      initializing = true;
+      config = startupConfig();
+      initializing = false;
+    });
+  }
+  return config;
+}
+
+// Best wall time of 'reps' runs, in seconds
+template <typename F>
+double bestOf(int reps, F&& f) {
+  double best = 1e30;
+  for (int r = 0; r < reps; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    best = std::min(best, elapsed.count());
+  }
+  return best;
+}
+}  // namespace
+
+int Config::threads() const {
+  if (max_threads > 0) return max_threads;
+  int hw = hardwareThreads();
+  return hw > 2 ? hw - 2 : 1;
+}
+
+const Config& current() { return active(); }
+
+void set(const Config& config) { active() = sanitize(config); }
+
+std::string defaultPath() {
+  if (const char* file = std::getenv("TALAWA_TUNING_FILE")) return file;
+  if (const char* xdg = std::getenv("XDG_CACHE_HOME")) {
+    return std::string(xdg) + "/talawa/tuning.yaml";
+  }
+  if (const char* home = std::getenv("HOME")) {
+    return std::string(home) + "/.cache/talawa/tuning.yaml";
+  }
+  return "talawa_tuning.yaml";
+}
+
+bool save(const Config& config, const std::string& path) {
+  std::error_code ec;
+  auto dir = std::filesystem::path(path).parent_path();
+  if (!dir.empty()) std::filesystem::create_directories(dir, ec);
+
+  std::ofstream out(path);
+  if (!out) return false;
+
+  out << "# talawa-ai tuning cache (regenerate with Autotune.benchmark)\n";
+  out << "host: " << hostKey() << "\n";
+  out << "gemm:\n";
+  out << "  mc: " << config.mc << "\n";
+  out << "  kc: " << config.kc << "\n";
+  out << "  nc: " << config.nc << "\n";
+  out << "  parallel_ops: " << config.gemm_parallel_ops << "\n";
+  out << "max_threads: " << config.max_threads << "\n";
+  out << "transpose:\n";
+  out << "  block: " << config.transpose_block << "\n";
+  out << "  parallel_elems: " << config.transpose_parallel_elems << "\n";
+
+  out.close();
+  return out.good();
+}
+
+std::optional<Config> load(const std::string& path) {
+  std::ifstream in(path);
+  if (!in) return std::nullopt;
+
+  // Flat "key: value" lines; the section header picks the key prefix
+  Config config;
+  std::string line, section;
+  bool same_host = false;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    auto colon = line.find(':');
+    if (colon == std::string::npos) continue;
+
+    bool nested = line[0] == ' ';
+    std::string key = line.substr(line.find_first_not_of(' '),
+                                  colon - line.find_first_not_of(' '));
+    std::string value = colon + 2 <= line.size() ? line.substr(colon + 2) : "";
+    if (!nested) section = value.empty() ? key : "";
+    if (value.empty()) continue;
+    if (nested) key = section + "." + key;
+
+    try {
+      if (key == "host") same_host = value == hostKey();
+      else if (key == "gemm.mc") config.mc = std::stoi(value);
+      else if (key == "gemm.kc") config.kc = std::stoi(value);
+      else if (key == "gemm.nc") config.nc = std::stoi(value);
+      else if (key == "gemm.parallel_ops")
+        config.gemm_parallel_ops = std::stoll(value);
+      else if (key == "max_threads") config.max_threads = std::stoi(value);
+      else if (key == "transpose.block")
+        config.transpose_block = std::stoi(value);
+      else if (key == "transpose.parallel_elems")
+        config.transpose_parallel_elems = std::stoll(value);
+    } catch (const std::exception&) {
+      return std::nullopt;  // Corrupt file: fall back to defaults
+    }
+  }
+
+  if (!same_host) return std::nullopt;
+  return sanitize(config);
+}
+
+Config autotune(bool verbose) {
+  const Config saved = current();
+  Config best = sanitize(Config{});
+  best.gemm_parallel_ops = 0;  // Measure blockings with the threads on
+
+  auto log = [&](const std::string& what, long long value, double seconds) {
+    if (verbose) {
+      std::cout << "[Tuning] " << what << " = " << value << ": "
+                << seconds * 1e3 << " ms" << std::endl;
+    }
+  };
+
+  // Representative shapes (m, k, n): a square block, a dense layer on an
+  // MNIST batch, and a tall-skinny im2col product
+  const int shapes[][3] = {{512, 512, 512}, {64, 784, 256}, {2048, 75, 32}};
+  std::vector<Matrix> lhs, rhs, out;
+  for (const auto& s : shapes) {
+    lhs.push_back(Matrix::random(s[0], s[1]));
+    rhs.push_back(Matrix::random(s[1], s[2]));
+    out.push_back(Matrix(s[0], s[2]));
+  }
+  auto gemmTime = [&](const Config& candidate) {
+    set(candidate);
+    double total = 0.0;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      total += bestOf(3, [&] { lhs[i].dot(rhs[i], out[i]); });
+    }
+    return total;
+  };
+
+  // Coordinate descent: tune one knob at a time, keeping the best so far
+  auto tune = [&](const char* name, int Config::*field,
+                  const std::vector<int>& candidates, auto&& measure) {
+    int best_value = best.*field;
+    double best_time = 1e30;
+    for (int value : candidates) {
+      Config trial = best;
+      trial.*field = value;
+      double t = measure(trial);
+      log(name, value, t);
+      if (t < best_time) {
+        best_time = t;
+        best_value = value;
+      }
+    }
+    best.*field = best_value;
+  };
+
+  // 1. Threads first: blockings interact with how rows are split
+  std::vector<int> thread_counts;
+  for (int t = 1; t < hardwareThreads(); t *= 2) thread_counts.push_back(t);
+  thread_counts.push_back(hardwareThreads());
+  tune("max_threads", &Config::max_threads, thread_counts, gemmTime);
+
+  // 2. Cache blocking
+  tune("gemm.kc", &Config::kc, {128, 192, 256, 384, 512}, gemmTime);
+  tune("gemm.mc", &Config::mc, {48, 72, 96, 120, 144, 192, 240}, gemmTime);
+  tune("gemm.nc", &Config::nc, {512, 1024, 2048, 4096, 8192}, gemmTime);
+
+  // 3. Serial/parallel cutoff: smallest cube where threads win
+  best.gemm_parallel_ops = LLONG_MAX;
+  if (best.threads() > 1) {
+    for (int s : {8, 12, 16, 24, 32, 48, 64, 96, 128, 192}) {
+      Matrix a = Matrix::random(s, s), b = Matrix::random(s, s), c(s, s);
+      auto timeWith = [&](long long cutoff) {
+        Config trial = best;
+        trial.gemm_parallel_ops = cutoff;
+        set(trial);
+        return bestOf(20, [&] { a.dot(b, c); });
+      };
+      if (timeWith(0) < timeWith(LLONG_MAX)) {
+        best.gemm_parallel_ops = static_cast<long long>(s) * s * s;
+        break;
+      }
+    }
+  }
+
+  // 4. Transpose tile and cutoff
+  Matrix t_src = Matrix::random(1500, 1100);
+  Matrix t_dst(1100, 1500);
+  auto transposeTime = [&](const Config& candidate) {
+    set(candidate);
+    return bestOf(5, [&] { t_src.transpose(t_dst); });
+  };
+  tune("transpose.block", &Config::transpose_block, {8, 16, 32, 64, 128},
+       transposeTime);
+
+  best.transpose_parallel_elems = LLONG_MAX;
+  if (best.threads() > 1) {
+    for (int s : {32, 64, 128, 256, 512, 1024}) {
+      Matrix src = Matrix::random(s, s), dst(s, s);
+      auto timeWith = [&](long long cutoff) {
+        Config trial = best;
+        trial.transpose_parallel_elems = cutoff;
+        set(trial);
+        return bestOf(10, [&] { src.transpose(dst); });
+      };
+      if (timeWith(0) < timeWith(LLONG_MAX)) {
+        best.transpose_parallel_elems = static_cast<long long>(s) * s;
+        break;
+      }
+    }
+  }
+  if (verbose) {
+    std::cout << "[Tuning] gemm.parallel_ops = " << best.gemm_parallel_ops
+              << ", transpose.parallel_elems = "
+              << best.transpose_parallel_elems << std::endl;
+  }
+
+  set(saved);
+  return sanitize(best);
+}
+
+}  // namespace tuning
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,327 @@
+#include "talawa/core/Winograd.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "talawa/core/Parallel.hpp"
+
+namespace talawa {
+namespace core {
+namespace winograd {
+
+namespace {
+// Transformed inputs and products of one chunk of tiles, in floats (per
+// thread). The point GEMMs only have 'channels' of depth, so they need
+// many rows to run well: bigger chunks are faster up to about this size.
+constexpr int CHUNK_FLOATS = 1 << 19;
+
+// Channels (or filters) the transforms work on at once
+constexpr int LANES = 16;
+
+// F(M x M, 3 x 3) on ALPHA = M + 2 point tiles (Lavin & Gray, "Fast
+// Algorithms for Convolutional Neural Networks"). G transforms the
+// filters; input() and output() apply B^T and A^T along one axis of a
+// tile, on LANES channels at once, with their common terms factored out.
+template <int M>
+struct Transform;
+
+template <>
+struct Transform<2> {
+  static constexpr int ALPHA = 4;
+  static constexpr float G[4][3] = {
+      {1, 0, 0}, {0.5f, 0.5f, 0.5f}, {0.5f, -0.5f, 0.5f}, {0, 0, 1}};
+
+  // B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1]
+  static void input(const float* const* d, float* const* y) {
+    for (int e = 0; e < LANES; ++e) {
+      y[0][e] = d[0][e] - d[2][e];
+      y[1][e] = d[1][e] + d[2][e];
+      y[2][e] = d[2][e] - d[1][e];
+      y[3][e] = d[1][e] - d[3][e];
+    }
+  }
+  // A^T = [1 1 1 0; 0 1 -1 -1]
+  static void output(const float* const* m, float* const* y) {
+    for (int e = 0; e < LANES; ++e) {
+      y[0][e] = m[0][e] + m[1][e] + m[2][e];
+      y[1][e] = m[1][e] - m[2][e] - m[3][e];
+    }
+  }
+};
+
+template <>
+struct Transform<4> {
+  static constexpr int ALPHA = 6;
+  static constexpr float G[6][3] = {{1 / 4.f, 0, 0},
+                                    {-1 / 6.f, -1 / 6.f, -1 / 6.f},
+                                    {-1 / 6.f, 1 / 6.f, -1 / 6.f},
+                                    {1 / 24.f, 1 / 12.f, 1 / 6.f},
+                                    {1 / 24.f, -1 / 12.f, 1 / 6.f},
+                                    {0, 0, 1}};
+
+  // B^T = [4  0 -5  0 1 0;  0 -4 -4  1 1 0;  0  4 -4 -1 1 0;
+  //        0 -2 -1  2 1 0;  0  2 -1 -2 1 0;  0  4  0 -5 0 1]
+  static void input(const float* const* d, float* const* y) {
+    for (int e = 0; e < LANES; ++e) {
+      float d0 = d[0][e], d1 = d[1][e], d2 = d[2][e];
+      float d3 = d[3][e], d4 = d[4][e], d5 = d[5][e];
+      float a = d4 - 4 * d2, b = d3 - 4 * d1;
+      float c = d4 - d2, f = 2 * (d3 - d1);
+      y[0][e] = 4 * d0 - 5 * d2 + d4;
+      y[1][e] = a + b;
+      y[2][e] = a - b;
+      y[3][e] = c + f;
+      y[4][e] = c - f;
+      y[5][e] = 4 * d1 - 5 * d3 + d5;
+    }
+  }
+  // A^T = [1 1 1 1 1 0;  0 1 -1 2 -2 0;  0 1 1 4 4 0;  0 1 -1 8 -8 1]
+  static void output(const float* const* m, float* const* y) {
+    for (int e = 0; e < LANES; ++e) {
+      float a = m[1][e] + m[2][e], b = m[1][e] - m[2][e];
+      float c = m[3][e] + m[4][e], d = m[3][e] - m[4][e];
+      y[0][e] = m[0][e] + a + c;
+      y[1][e] = b + 2 * d;
+      y[2][e] = a + 4 * c;
+      y[3][e] = b + 8 * d + m[5][e];
+    }
+  }
+};
+
+// Copies n <= LANES floats; full vectors as fixed-size, inlined moves
+inline void copyLanes(const float* src, int n, float* dst) {
+  if (n == LANES) {
+    for (int e = 0; e < LANES; ++e) dst[e] = src[e];
+  } else {
+    std::copy_n(src, n, dst);
+  }
+}
+
+// out = T in T^T for a 1-D transform T from COLS to R points (e.g.
+// Transform::input): down the columns of the tile, then along its rows
+template <int R, int COLS, typename Apply>
+void sandwich(Apply apply, const float (&in)[COLS][COLS][LANES],
+              float (&out)[R][R][LANES]) {
+  float tmp[R][COLS][LANES];
+  const float* x[COLS];
+  float* y[R];
+  for (int l = 0; l < COLS; ++l) {
+    for (int k = 0; k < COLS; ++k) x[k] = in[k][l];
+    for (int i = 0; i < R; ++i) y[i] = tmp[i][l];
+    apply(x, y);
+  }
+  for (int i = 0; i < R; ++i) {
+    for (int l = 0; l < COLS; ++l) x[l] = tmp[i][l];
+    for (int j = 0; j < R; ++j) y[j] = out[i][j];
+    apply(x, y);
+  }
+}
+
+template <int M>
+void transformFilters(int channels, int filters, const Weights& w,
+                      float* U) {
+  using T = Transform<M>;
+  constexpr int ALPHA = T::ALPHA;
+  std::ptrdiff_t point_stride = static_cast<std::ptrdiff_t>(channels) * filters;
+
+  // U[point][c][f] = (G g G^T)[point] for the 3x3 filter g from c to f
+  parallel::parallelFor(0, channels, 16, [&](auto first, auto last) {
+    float g[9], gt[ALPHA * 3];
+    for (auto c = first; c < last; ++c) {
+      for (int f = 0; f < filters; ++f) {
+        const float* base = w.data + c * w.c_in + f * w.c_out;
+        for (int ky = 0; ky < 3; ++ky) {
+          for (int kx = 0; kx < 3; ++kx) {
+            g[ky * 3 + kx] = base[ky * w.y + kx * w.x];
+          }
+        }
+        for (int i = 0; i < ALPHA; ++i) {
+          for (int kx = 0; kx < 3; ++kx) {
+            gt[i * 3 + kx] = T::G[i][0] * g[kx] + T::G[i][1] * g[3 + kx] +
+                             T::G[i][2] * g[6 + kx];
+          }
+        }
+        float* u = U + c * filters + f;
+        for (int i = 0; i < ALPHA; ++i) {
+          for (int j = 0; j < ALPHA; ++j) {
+            u[(i * ALPHA + j) * point_stride] = gt[i * 3] * T::G[j][0] +
+                                                gt[i * 3 + 1] * T::G[j][1] +
+                                                gt[i * 3 + 2] * T::G[j][2];
+          }
+        }
+      }
+    }
+  });
+}
+
+template <int M>
+void run(const Image& in, int padding, const Filters& filters, float* out,
+         std::ptrdiff_t ldo, const gemm::Epilogue& epilogue) {
+  using T = Transform<M>;
+  constexpr int ALPHA = T::ALPHA, POINTS = ALPHA * ALPHA;
+  const int C = in.channels, F = filters.filters();
+  const int H = in.height, W = in.width;
+  const int OH = H + 2 * padding - 2, OW = W + 2 * padding - 2;
+  if (OH <= 0 || OW <= 0 || in.batch <= 0) return;
+
+  const int tiles_y = (OH + M - 1) / M, tiles_x = (OW + M - 1) / M;
+  const long long tiles = static_cast<long long>(in.batch) * tiles_y * tiles_x;
+  // Tiles per chunk: as many as fit, as long as every thread gets a chunk
+  long long fit = CHUNK_FLOATS / (POINTS * (C + F));
+  long long share = (tiles + parallel::threadBudget() - 1) /
+                    parallel::threadBudget();
+  const int chunk =
+      static_cast<int>(std::clamp<long long>(std::min(fit, share), 8, 1024));
+  const long long chunks = (tiles + chunk - 1) / chunk;
+
+  parallel::parallelFor(0, chunks, 1, [&](auto first, auto last) {
+    // Per chunk: V (POINTS, chunk, C) inputs and P (POINTS, chunk, F)
+    // products, laid out so each point's GEMM reads and writes one block
+    static thread_local std::vector<float> V, P;
+    V.resize(static_cast<size_t>(POINTS) * chunk * C);
+    P.resize(static_cast<size_t>(POINTS) * chunk * F);
+    const std::ptrdiff_t v_point = static_cast<std::ptrdiff_t>(chunk) * C;
+    const std::ptrdiff_t p_point = static_cast<std::ptrdiff_t>(chunk) * F;
+
+    for (auto ch = first; ch < last; ++ch) {
+      long long t0 = ch * chunk;
+      int count = static_cast<int>(std::min<long long>(chunk, tiles - t0));
+
+      // 1. Input transform: V = B^T d B for every tile's patch d, LANES
+      // channels at a time
+      for (int t = 0; t < count; ++t) {
+        long long tile = t0 + t;
+        int b = static_cast<int>(tile / (tiles_y * tiles_x));
+        int rest = static_cast<int>(tile % (tiles_y * tiles_x));
+        int y0 = rest / tiles_x * M - padding;
+        int x0 = rest % tiles_x * M - padding;
+        const float* image = in.data + b * in.image_stride;
+
+        for (int c0 = 0; c0 < C; c0 += LANES) {
+          int n = std::min(LANES, C - c0);
+          float d[ALPHA][ALPHA][LANES] = {}, v[ALPHA][ALPHA][LANES];
+          for (int ky = 0; ky < ALPHA; ++ky) {
+            int y = y0 + ky;
+            if (y < 0 || y >= H) continue;  // Padding
+            for (int kx = 0; kx < ALPHA; ++kx) {
+              int x = x0 + kx;
+              if (x < 0 || x >= W) continue;
+              const float* src = image + (y * W + x) * in.pixel_stride +
+                                 c0 * in.channel_stride;
+              if (in.channel_stride == 1) {
+                copyLanes(src, n, d[ky][kx]);
+              } else {
+                for (int c = 0; c < n; ++c) {
+                  d[ky][kx][c] = src[c * in.channel_stride];
+                }
+              }
+            }
+          }
+          sandwich(T::input, d, v);
+          float* dst = V.data() + t * C + c0;
+          for (int p = 0; p < POINTS; ++p) {
+            copyLanes(v[p / ALPHA][p % ALPHA], n, dst + p * v_point);
+          }
+        }
+      }
+
+      // 2. One GEMM per point: (tiles, C) . (C, F)
+      for (int p = 0; p < POINTS; ++p) {
+        gemm::sgemm(count, {V.data() + p * v_point, C, 1}, filters.point(p),
+                    P.data() + p * p_point, F);
+      }
+
+      // 3. Output transform: Y = A^T P A, then bias and activation
+      for (int t = 0; t < count; ++t) {
+        long long tile = t0 + t;
+        int b = static_cast<int>(tile / (tiles_y * tiles_x));
+        int rest = static_cast<int>(tile % (tiles_y * tiles_x));
+        int oy0 = rest / tiles_x * M, ox0 = rest % tiles_x * M;
+        int rows = std::min(M, OH - oy0), cols = std::min(M, OW - ox0);
+        auto row = [&](int i, int j) {
+          return out + ((static_cast<std::ptrdiff_t>(b) * OH + oy0 + i) * OW +
+                        ox0 + j) *
+                           ldo;
+        };
+
+        for (int f0 = 0; f0 < F; f0 += LANES) {
+          int n = std::min(LANES, F - f0);
+          float m[ALPHA][ALPHA][LANES] = {}, y[M][M][LANES];
+          const float* src = P.data() + t * F + f0;
+          for (int p = 0; p < POINTS; ++p) {
+            copyLanes(src + p * p_point, n, m[p / ALPHA][p % ALPHA]);
+          }
+          sandwich(T::output, m, y);
+          for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+              float* dst = row(i, j) + f0;
+              if (epilogue.bias) {
+                const float* bias = epilogue.bias + f0;
+                for (int f = 0; f < n; ++f) dst[f] = y[i][j][f] + bias[f];
+              } else {
+                copyLanes(y[i][j], n, dst);
+              }
+            }
+          }
+        }
+        if (epilogue.activation) {
+          for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) epilogue.activation(row(i, j), F);
+          }
+        }
+      }
+    }
+  });
+}
+}  // namespace
+
+int pickTile(int out_height, int out_width) {
+  auto multiplies = [&](int m) {
+    long long tiles = static_cast<long long>((out_height + m - 1) / m) *
+                      ((out_width + m - 1) / m);
+    return tiles * (m + 2) * (m + 2);
+  };
+  return multiplies(4) < multiplies(2) ? 4 : 2;
+}
+
+Filters::Filters(int tile, int channels, int filters, const Weights& weights)
+    : tile_(tile), channels_(channels), filters_(filters) {
+  int alpha = tile + 2;
+  std::vector<float> U(static_cast<size_t>(alpha) * alpha * channels *
+                       filters);
+  if (tile == 2) {
+    transformFilters<2>(channels, filters, weights, U.data());
+  } else if (tile == 4) {
+    transformFilters<4>(channels, filters, weights, U.data());
+  } else {
+    throw std::invalid_argument("Winograd: tile must be 2 or 4, got " +
+                                std::to_string(tile));
+  }
+
+  points_.reserve(alpha * alpha);
+  for (int p = 0; p < alpha * alpha; ++p) {
+    points_.emplace_back(
+        channels, filters,
+        gemm::Operand{U.data() + static_cast<size_t>(p) * channels * filters,
+                      filters, 1});
+  }
+}
+
+void conv3x3(const Image& input, int padding, const Filters& filters,
+             float* out, std::ptrdiff_t ldo, const gemm::Epilogue& epilogue) {
+  if (input.channels != filters.channels()) {
+    throw std::invalid_argument(
+        "Winograd: filters for " + std::to_string(filters.channels()) +
+        " channels applied to an image of " + std::to_string(input.channels));
+  }
+  if (filters.tile() == 2) {
+    run<2>(input, padding, filters, out, ldo, epilogue);
+  } else {
+    run<4>(input, padding, filters, out, ldo, epilogue);
+  }
+}
+
+}  // namespace winograd
+}  // namespace core
+}  // namespace talawa
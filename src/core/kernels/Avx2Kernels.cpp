@@ -0,0 +1,88 @@
+// AVX2 + FMA tier (compiled with -mavx2 -mfma, see CMakeLists.txt)
+#include <math.h>
+
+#include <cstddef>
+
+#include "talawa/core/Kernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#include <immintrin.h>
+
+namespace talawa {
+namespace core {
+namespace kernels {
+namespace avx2 {
+
+namespace {
+#include "ElementwiseKernels.inc"
+
+constexpr int MR = 6;
+constexpr int NR = 16;
+
+// C tile (6 x 16) (+)= packed A sliver . packed B sliver
+// 12 ymm accumulators + 2 B vectors + 1 broadcast A = 15 of 16 registers.
+void gemmMicro(int kc, const float* A, const float* B, float* C,
+               std::ptrdiff_t ldc, bool accumulate) {
+  __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+  __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+  __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+  __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+  __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+  __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+  for (int p = 0; p < kc; ++p) {
+    __m256 b0 = _mm256_load_ps(B);
+    __m256 b1 = _mm256_load_ps(B + 8);
+    __m256 a;
+
+    a = _mm256_broadcast_ss(A + 0);
+    c00 = _mm256_fmadd_ps(a, b0, c00);
+    c01 = _mm256_fmadd_ps(a, b1, c01);
+    a = _mm256_broadcast_ss(A + 1);
+    c10 = _mm256_fmadd_ps(a, b0, c10);
+    c11 = _mm256_fmadd_ps(a, b1, c11);
+    a = _mm256_broadcast_ss(A + 2);
+    c20 = _mm256_fmadd_ps(a, b0, c20);
+    c21 = _mm256_fmadd_ps(a, b1, c21);
+    a = _mm256_broadcast_ss(A + 3);
+    c30 = _mm256_fmadd_ps(a, b0, c30);
+    c31 = _mm256_fmadd_ps(a, b1, c31);
+    a = _mm256_broadcast_ss(A + 4);
+    c40 = _mm256_fmadd_ps(a, b0, c40);
+    c41 = _mm256_fmadd_ps(a, b1, c41);
+    a = _mm256_broadcast_ss(A + 5);
+    c50 = _mm256_fmadd_ps(a, b0, c50);
+    c51 = _mm256_fmadd_ps(a, b1, c51);
+
+    A += MR;
+    B += NR;
+  }
+
+  __m256 acc[MR][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                       {c30, c31}, {c40, c41}, {c50, c51}};
+  for (int r = 0; r < MR; ++r) {
+    float* row = C + r * ldc;
+    if (accumulate) {
+      acc[r][0] = _mm256_add_ps(acc[r][0], _mm256_loadu_ps(row));
+      acc[r][1] = _mm256_add_ps(acc[r][1], _mm256_loadu_ps(row + 8));
+    }
+    _mm256_storeu_ps(row, acc[r][0]);
+    _mm256_storeu_ps(row + 8, acc[r][1]);
+  }
+}
+}  // namespace
+
+void fill(KernelTable& t) {
+  t.level = cpu::SimdLevel::AVX2;
+  t.name = "AVX2+FMA";
+  t.mr = MR;
+  t.nr = NR;
+  t.gemm_micro = gemmMicro;
+  fillElementwise(t);
+}
+
+}  // namespace avx2
+}  // namespace kernels
+}  // namespace core
+}  // namespace talawa
+#endif
@@ -0,0 +1,89 @@
+// AVX-512 tier (compiled with -mavx512f -mavx2 -mfma, see CMakeLists.txt)
+#include <math.h>
+
+#include <cstddef>
+
+#include "talawa/core/Kernels.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+
+namespace talawa {
+namespace core {
+namespace kernels {
+namespace avx512 {
+
+namespace {
+#include "ElementwiseKernels.inc"
+
+constexpr int MR = 6;
+constexpr int NR = 32;
+
+// C tile (6 x 32) (+)= packed A sliver . packed B sliver
+// 12 zmm accumulators: per k step, 12 FMAs against 2 B loads + 6
+// broadcasts, so the tile is FMA-bound rather than load-bound.
+void gemmMicro(int kc, const float* A, const float* B, float* C,
+               std::ptrdiff_t ldc, bool accumulate) {
+  __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+  __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+  __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+  __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+  __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+  __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+
+  for (int p = 0; p < kc; ++p) {
+    __m512 b0 = _mm512_load_ps(B);
+    __m512 b1 = _mm512_load_ps(B + 16);
+    __m512 a;
+
+    a = _mm512_set1_ps(A[0]);
+    c00 = _mm512_fmadd_ps(a, b0, c00);
+    c01 = _mm512_fmadd_ps(a, b1, c01);
+    a = _mm512_set1_ps(A[1]);
+    c10 = _mm512_fmadd_ps(a, b0, c10);
+    c11 = _mm512_fmadd_ps(a, b1, c11);
+    a = _mm512_set1_ps(A[2]);
+    c20 = _mm512_fmadd_ps(a, b0, c20);
+    c21 = _mm512_fmadd_ps(a, b1, c21);
+    a = _mm512_set1_ps(A[3]);
+    c30 = _mm512_fmadd_ps(a, b0, c30);
+    c31 = _mm512_fmadd_ps(a, b1, c31);
+    a = _mm512_set1_ps(A[4]);
+    c40 = _mm512_fmadd_ps(a, b0, c40);
+    c41 = _mm512_fmadd_ps(a, b1, c41);
+    a = _mm512_set1_ps(A[5]);
+    c50 = _mm512_fmadd_ps(a, b0, c50);
+    c51 = _mm512_fmadd_ps(a, b1, c51);
+
+    A += MR;
+    B += NR;
+  }
+
+  __m512 acc[MR][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                       {c30, c31}, {c40, c41}, {c50, c51}};
+  for (int r = 0; r < MR; ++r) {
+    float* row = C + r * ldc;
+    if (accumulate) {
+      acc[r][0] = _mm512_add_ps(acc[r][0], _mm512_loadu_ps(row));
+      acc[r][1] = _mm512_add_ps(acc[r][1], _mm512_loadu_ps(row + 16));
+    }
+    _mm512_storeu_ps(row, acc[r][0]);
+    _mm512_storeu_ps(row + 16, acc[r][1]);
+  }
+}
+}  // namespace
+
+void fill(KernelTable& t) {
+  t.level = cpu::SimdLevel::AVX512;
+  t.name = "AVX-512";
+  t.mr = MR;
+  t.nr = NR;
+  t.gemm_micro = gemmMicro;
+  fillElementwise(t);
+}
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace core
+}  // namespace talawa
+#endif
@@ -0,0 +1,50 @@
+// Baseline tier: plain C++, no ISA flags. Runs on any CPU.
+#include <math.h>
+
+#include <cstddef>
+
+#include "talawa/core/Kernels.hpp"
+
+namespace talawa {
+namespace core {
+namespace kernels {
+namespace scalar {
+
+namespace {
+#include "ElementwiseKernels.inc"
+
+constexpr int MR = 4;
+constexpr int NR = 4;
+
+void gemmMicro(int kc, const float* A, const float* B, float* C,
+               std::ptrdiff_t ldc, bool accumulate) {
+  float acc[MR][NR] = {};
+  for (int p = 0; p < kc; ++p) {
+    for (int r = 0; r < MR; ++r) {
+      for (int c = 0; c < NR; ++c) acc[r][c] += A[r] * B[c];
+    }
+    A += MR;
+    B += NR;
+  }
+  for (int r = 0; r < MR; ++r) {
+    float* row = C + r * ldc;
+    for (int c = 0; c < NR; ++c) {
+      row[c] = accumulate ? row[c] + acc[r][c] : acc[r][c];
+    }
+  }
+}
+}  // namespace
+
+void fill(KernelTable& t) {
+  t.level = cpu::SimdLevel::SCALAR;
+  t.name = "Scalar";
+  t.mr = MR;
+  t.nr = NR;
+  t.gemm_micro = gemmMicro;
+  fillElementwise(t);
+}
+
+}  // namespace scalar
+}  // namespace kernels
+}  // namespace core
+}  // namespace talawa
@@ -0,0 +1,89 @@
+// SSE4.1 tier (compiled with -msse4.1, see CMakeLists.txt)
+#include <math.h>
+
+#include <cstddef>
+
+#include "talawa/core/Kernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#include <smmintrin.h>
+
+namespace talawa {
+namespace core {
+namespace kernels {
+namespace sse4 {
+
+namespace {
+#include "ElementwiseKernels.inc"
+
+constexpr int MR = 6;
+constexpr int NR = 8;
+
+// C tile (6 x 8) (+)= packed A sliver . packed B sliver
+// 12 xmm accumulators + 2 B vectors + 1 broadcast A = 15 of 16 registers.
+// No FMA at this tier: separate multiply and add.
+void gemmMicro(int kc, const float* A, const float* B, float* C,
+               std::ptrdiff_t ldc, bool accumulate) {
+  __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+  __m128 c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+  __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+  __m128 c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+  __m128 c40 = _mm_setzero_ps(), c41 = _mm_setzero_ps();
+  __m128 c50 = _mm_setzero_ps(), c51 = _mm_setzero_ps();
+
+  for (int p = 0; p < kc; ++p) {
+    __m128 b0 = _mm_load_ps(B);
+    __m128 b1 = _mm_load_ps(B + 4);
+    __m128 a;
+
+    a = _mm_set1_ps(A[0]);
+    c00 = _mm_add_ps(c00, _mm_mul_ps(a, b0));
+    c01 = _mm_add_ps(c01, _mm_mul_ps(a, b1));
+    a = _mm_set1_ps(A[1]);
+    c10 = _mm_add_ps(c10, _mm_mul_ps(a, b0));
+    c11 = _mm_add_ps(c11, _mm_mul_ps(a, b1));
+    a = _mm_set1_ps(A[2]);
+    c20 = _mm_add_ps(c20, _mm_mul_ps(a, b0));
+    c21 = _mm_add_ps(c21, _mm_mul_ps(a, b1));
+    a = _mm_set1_ps(A[3]);
+    c30 = _mm_add_ps(c30, _mm_mul_ps(a, b0));
+    c31 = _mm_add_ps(c31, _mm_mul_ps(a, b1));
+    a = _mm_set1_ps(A[4]);
+    c40 = _mm_add_ps(c40, _mm_mul_ps(a, b0));
+    c41 = _mm_add_ps(c41, _mm_mul_ps(a, b1));
+    a = _mm_set1_ps(A[5]);
+    c50 = _mm_add_ps(c50, _mm_mul_ps(a, b0));
+    c51 = _mm_add_ps(c51, _mm_mul_ps(a, b1));
+
+    A += MR;
+    B += NR;
+  }
+
+  __m128 acc[MR][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                       {c30, c31}, {c40, c41}, {c50, c51}};
+  for (int r = 0; r < MR; ++r) {
+    float* row = C + r * ldc;
+    if (accumulate) {
+      acc[r][0] = _mm_add_ps(acc[r][0], _mm_loadu_ps(row));
+      acc[r][1] = _mm_add_ps(acc[r][1], _mm_loadu_ps(row + 4));
+    }
+    _mm_storeu_ps(row, acc[r][0]);
+    _mm_storeu_ps(row + 4, acc[r][1]);
+  }
+}
+}  // namespace
+
+void fill(KernelTable& t) {
+  t.level = cpu::SimdLevel::SSE4;
+  t.name = "SSE4.1";
+  t.mr = MR;
+  t.nr = NR;
+  t.gemm_micro = gemmMicro;
+  fillElementwise(t);
+}
+
+}  // namespace sse4
+}  // namespace kernels
+}  // namespace core
+}  // namespace talawa
+#endif
@@ -0,0 +1,167 @@
+#include "talawa/neuralnetwork/ActivationPlan.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace talawa {
+namespace nn {
+
+namespace {
+// Offsets are kept on cache lines, like every other buffer
+constexpr size_t ALIGN_FLOATS = core::memory::ALIGNMENT / sizeof(float);
+constexpr size_t NEVER = std::numeric_limits<size_t>::max();
+
+size_t alignUp(size_t count) {
+  return (count + ALIGN_FLOATS - 1) / ALIGN_FLOATS * ALIGN_FLOATS;
+}
+
+// Inclusive range of schedule positions
+struct Interval {
+  size_t first, last;
+};
+
+struct Placement {
+  const ILayer* layer;
+  int slot;
+  size_t count;  // Floats, aligned
+  std::vector<Interval> live;
+  size_t offset = 0;
+
+  bool overlaps(const Placement& other) const {
+    for (const auto& a : live) {
+      for (const auto& b : other.live) {
+        if (a.first <= b.last && b.first <= a.last) return true;
+      }
+    }
+    return false;
+  }
+};
+
+// Forward pass, then the segments last to first: each runs forward again
+// (up to, not including, its checkpoint) and then backward
+std::vector<ActivationPlan::Step> makeSchedule(size_t layers,
+                                               size_t segment_layers) {
+  std::vector<ActivationPlan::Step> steps;
+  for (size_t i = 0; i < layers; ++i) steps.push_back({i, true});
+
+  size_t segment = segment_layers > 1 ? segment_layers : layers;
+  size_t segments = segment > 0 ? (layers + segment - 1) / segment : 0;
+  for (size_t s = segments; s-- > 0;) {
+    size_t first = s * segment, last = std::min(layers, first + segment);
+    if (s + 1 < segments) {
+      for (size_t i = first; i + 1 < last; ++i) steps.push_back({i, true});
+    }
+    for (size_t i = last; i-- > first;) steps.push_back({i, false});
+  }
+  return steps;
+}
+}  // namespace
+
+ActivationPlan::ActivationPlan(
+    const std::vector<std::unique_ptr<ILayer>>& layers, size_t batch,
+    size_t segment_layers)
+    : max_batch(std::max<size_t>(1, batch)),
+      segment_layers(segment_layers),
+      steps(makeSchedule(layers.size(), segment_layers)) {
+  // 1. When each layer runs forward and backward
+  size_t L = layers.size();
+  std::vector<std::vector<size_t>> forwards(L), backwards(L);
+  for (size_t t = 0; t < steps.size(); ++t) {
+    (steps[t].forward ? forwards : backwards)[steps[t].layer].push_back(t);
+  }
+  // Last of 'times' in (after, before), or 'after' if none
+  auto lastUse = [](const std::vector<size_t>& times, size_t after,
+                    size_t before) {
+    size_t last = after;
+    for (size_t t : times) {
+      if (t > after && t < before) last = std::max(last, t);
+    }
+    return last;
+  };
+
+  // 2. Live ranges. Outputs written by a forward stay alive until the next
+  // layer has read them (forward and backward) and the layer's own
+  // backward is done, or until the layer overwrites them. Input gradients
+  // wait for the next backward of the schedule.
+  std::vector<Placement> buffers;
+  for (size_t i = 0; i < L; ++i) {
+    for (const auto& request : layers[i]->trainingBuffers(max_batch)) {
+      if (request.count == 0) continue;
+      Placement p{layers[i].get(), request.slot, alignUp(request.count), {}};
+
+      const auto& writes = request.lifetime == BufferLifetime::FORWARD ||
+                                   request.lifetime == BufferLifetime::SAVED
+                               ? forwards[i]
+                               : backwards[i];
+      for (size_t w = 0; w < writes.size(); ++w) {
+        size_t t = writes[w];
+        size_t end = t;
+        if (request.lifetime == BufferLifetime::SAVED) {
+          size_t next = w + 1 < writes.size() ? writes[w + 1] : NEVER;
+          end = lastUse(backwards[i], t, next);
+          if (i + 1 < L) {
+            end = std::max(end, lastUse(forwards[i + 1], t, next));
+            end = std::max(end, lastUse(backwards[i + 1], t, next));
+          }
+        } else if (request.lifetime == BufferLifetime::INPUT_GRADIENT) {
+          for (size_t u = t + 1; u < steps.size(); ++u) {
+            if (!steps[u].forward) {
+              end = u;
+              break;
+            }
+          }
+        }
+        p.live.push_back({t, end});
+      }
+      unshared += p.count;
+      buffers.push_back(std::move(p));
+    }
+  }
+
+  // 3. Greedy by size: each buffer takes the lowest gap that is free for
+  // its whole live range
+  std::vector<Placement*> order;
+  for (auto& p : buffers) order.push_back(&p);
+  std::stable_sort(order.begin(), order.end(),
+                   [](const Placement* a, const Placement* b) {
+                     return a->count > b->count;
+                   });
+
+  size_t total = 0;
+  std::vector<const Placement*> placed, live;
+  for (Placement* p : order) {
+    live.clear();
+    for (const Placement* q : placed) {
+      if (q->overlaps(*p)) live.push_back(q);
+    }
+    std::sort(live.begin(), live.end(),
+              [](const Placement* a, const Placement* b) {
+                return a->offset < b->offset;
+              });
+
+    size_t offset = 0;
+    for (const Placement* q : live) {
+      if (q->offset >= offset + p->count) break;  // Fits in front of q
+      offset = std::max(offset, q->offset + q->count);
+    }
+    p->offset = offset;
+    total = std::max(total, offset + p->count);
+    placed.push_back(p);
+  }
+
+  // 4. One arena; every buffer of the context is a slice of it
+  arena.resizeForOverwrite(total);
+  for (const auto& p : buffers) {
+    ctx.bind(p.layer, p.slot, arena.data() + p.offset, p.count);
+  }
+}
+
+size_t ActivationPlan::recomputedLayers() const {
+  // Every layer runs backward once, and forward once plus recomputations
+  size_t forwards = 0;
+  for (const auto& step : steps) forwards += step.forward;
+  return forwards - (steps.size() - forwards);
+}
+
+}  // namespace nn
+}  // namespace talawa
@@ -1,16 +1,101 @@
 #include "talawa/neuralnetwork/Conv2DLayer.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <iostream>
 #include <sstream>
+#include <utility>
+
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Parallel.hpp"
 
 namespace talawa::nn {
 
 using namespace core;
 
+namespace {
+// Training buffers (see trainingBuffers). infer() uses the first two.
+enum Slot {
+  PIXELS,           // Pixel-major GEMM output (forward, NCHW)
+  OUTPUT,           // The layer's output
+  SCRATCH,          // Pixel-major gradient / image-major dZ (backward, NCHW)
+  A_PIXELS,         // Pixel-major output (NCHW, non-element-wise activations)
+  DZ,               // Pixel-major dZ (backward)
+  FLIPPED_KERNELS,  // Kernels rearranged for the data gradient (backward)
+  DX_PIXELS,        // Pixel-major dL/dX (backward, NCHW)
+  INPUT_GRADIENT,   // dL/dX
+};
+
+// A contiguous (Batch, OH*OW*F) NHWC image as its (Batch*OH*OW, F) pixels
+template <typename View>
+View pixelRows(const View& image, size_t filters) {
+  if (!image.isContiguous()) {
+    THROW_talawa_ERROR(Conv2DLayer, "NHWC images must be contiguous, got a "
+                                        << image.rows << "x" << image.cols
+                                        << " view of stride " << image.stride);
+  }
+  return View(image.rawData(), image.size() / filters, filters);
+}
+
+// (Batch*N, C) pixel-major rows <-> (Batch, C*N) channel planes
+void pixelsToPlanes(const ConstMatrixView& pixels, const MatrixView& planes,
+                    size_t num_pixels, size_t channels) {
+  // Parallelize over the batch; each image is transposed channel by channel
+  parallel::parallelFor(0, planes.rows, 1, [&](auto first, auto last) {
+    for (auto b = first; b < last; ++b) {
+      for (size_t c = 0; c < channels; ++c) {
+        float* dest = planes.row(b) + c * num_pixels;
+        const float* src = pixels.row(static_cast<size_t>(b) * num_pixels) + c;
+        for (size_t p = 0; p < num_pixels; ++p) {
+          dest[p] = src[p * pixels.stride];
+        }
+      }
+    }
+  });
+}
+
+void planesToPixels(const ConstMatrixView& planes, const MatrixView& pixels,
+                    size_t num_pixels, size_t channels) {
+  parallel::parallelFor(0, planes.rows, 1, [&](auto first, auto last) {
+    for (auto b = first; b < last; ++b) {
+      for (size_t c = 0; c < channels; ++c) {
+        const float* src = planes.row(b) + c * num_pixels;
+        float* dest = pixels.row(static_cast<size_t>(b) * num_pixels) + c;
+        for (size_t p = 0; p < num_pixels; ++p) {
+          dest[p * pixels.stride] = src[p];
+        }
+      }
+    }
+  });
+}
+
+gemm::Operand asOperand(const ConstMatrixView& m) {
+  return {m.rawData(), static_cast<std::ptrdiff_t>(m.stride), 1};
+}
+
+// Weight (ky, kx, c, f) of the (K*K*D, Filters) kernels, whose rows run
+// (Depth, KernelY, KernelX) in NCHW and (KernelY, KernelX, Depth) in NHWC
+winograd::Weights kernelWeights(const Matrix& kernels, size_t kernel_size,
+                                int depth, Layout layout) {
+  auto F = static_cast<std::ptrdiff_t>(kernels.cols);
+  auto D = static_cast<std::ptrdiff_t>(depth);
+  auto K = static_cast<std::ptrdiff_t>(kernel_size);
+  if (layout == Layout::NHWC) {
+    return {kernels.rawData(), K * D * F, D * F, F, 1};
+  }
+  return {kernels.rawData(), K * F, F, K * K * F, 1};
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+}  // namespace
+
 // Default constructor for load-time construction
-Conv2DLayer::Conv2DLayer()
+Conv2DLayer::Conv2DLayer(Layout layout)
     : depth(0),
       input_height(0),
       input_width(0),
@@ -19,26 +104,32 @@ Conv2DLayer::Conv2DLayer()
       stride(0),
       padding(0),
       output_height(0),
-      output_width(0) {}
+      output_width(0),
+      layout(layout),
+      algorithm(ConvAlgorithm::AUTO) {}
 
 Conv2DLayer::Conv2DLayer(int d, int h, int w, int f, int k, int s, int p,
-                         Initializer init, Activation act)
+                         Initializer init, Activation act, Layout layout,
+                         ConvAlgorithm algorithm)
     : depth(d),
       input_height(h),
       input_width(w),
       filters(f),
       kernel_size(k),
       stride(s),
-      padding(p) {
+      padding(p),
+      layout(layout),
+      algorithm(algorithm) {
   this->initializer = init;
   this->activation = act;
 
   // 1. Calculate Output Dimensions
   output_height = (input_height - kernel_size + 2 * padding) / stride + 1;
   output_width = (input_width - kernel_size + 2 * padding) / stride + 1;
+  selectAlgorithm();
 
   // 2. Initialize Kernels
-  // Shape: (Fan-In, Fan-Out) -> (K*K*D, Filters)
+  // Shape: (Fan-In, Fan-Out) -> (K*K*D, Filters), rows in im2col's order
   int fan_in = kernel_size * kernel_size * depth;
   kernels = Matrix(fan_in, filters);
   initializer.apply(kernels);
@@ -124,252 +215,385 @@ void Conv2DLayer::load(std::istream& in_stream) {
   int fan_in = kernel_size * kernel_size * depth;
   this->kernels_grad = Matrix(fan_in, filters);
   this->biases_grad = Matrix(1, filters);
+  selectAlgorithm();
 }
 
-// --- IM2COL: The Heart of High-Performance Conv2D ---
-// Transforms input (Batch, D*H*W) -> (Batch*OutH*OutW, K*K*D)
-Matrix Conv2DLayer::im2col(const Matrix& input) {
-  int batch_size = input.rows;
-  int col_rows = batch_size * output_height * output_width;
-  int col_cols = kernel_size * kernel_size * depth;
-
-  Matrix result(col_rows, col_cols);
-
-// Note: This loop structure is complex. In a production library,
-// you might parallelize the batch loop with OpenMP.
-#pragma omp parallel for
-  for (int b = 0; b < batch_size; ++b) {
-    for (int y = 0; y < output_height; ++y) {
-      for (int x = 0; x < output_width; ++x) {
-        // Calculate the row index in the Result Matrix
-        int row_idx = b * (output_height * output_width) + y * output_width + x;
-
-        // Calculate the starting pixel in the Input Image
-        int in_y_origin = y * stride - padding;
-        int in_x_origin = x * stride - padding;
-
-        int col_idx = 0;
-
-        // Loop over the kernel window (Depth, KernelY, KernelX)
-        for (int c = 0; c < depth; ++c) {
-          for (int ky = 0; ky < kernel_size; ++ky) {
-            for (int kx = 0; kx < kernel_size; ++kx) {
-              int in_y = in_y_origin + ky;
-              int in_x = in_x_origin + kx;
-
-              float val = 0.0f;
-              // Boundary Check (Padding)
-              if (in_y >= 0 && in_y < input_height && in_x >= 0 &&
-                  in_x < input_width) {
-                // Flattened Index: D*H*W
-                int flat_idx = (c * input_height * input_width) +
-                               (in_y * input_width) + in_x;
-                val = input(b, flat_idx);
-              }
-
-              result(row_idx, col_idx) = val;
-              col_idx++;
-            }
-          }
-        }
-      }
-    }
+void Conv2DLayer::selectAlgorithm() {
+  bool eligible = kernel_size == 3 && stride == 1 && output_height > 0 &&
+                  output_width > 0;
+  if (algorithm == ConvAlgorithm::WINOGRAD && !eligible) {
+    THROW_talawa_ERROR(Conv2DLayer, "Winograd needs a 3x3 kernel of stride 1, "
+                                    "got k="
+                                        << kernel_size << " s=" << stride);
+  }
+  winograd_tile = 0;
+  if (eligible && algorithm != ConvAlgorithm::GEMM) {
+    winograd_tile = winograd::pickTile(output_height, output_width);
   }
-  return result;
 }
 
-// --- COL2IM: For Backpropagation ---
-// Transforms Gradient Cols -> Gradient Input Image
-Matrix Conv2DLayer::col2im(const Matrix& col_matrix) {
-  int batch_size = input_cache.rows;
-  Matrix result = Matrix::zeros(batch_size, depth * input_height * input_width);
-
-// Similar logic to im2col but accumulating gradients
-#pragma omp parallel for
-  for (int b = 0; b < batch_size; ++b) {
-    // Per-thread pointers to avoid per-access overhead
-    float* res_row =
-        result.rawData() +
-        static_cast<long long>(b) * (depth * input_height * input_width);
-    const float* col_buf = col_matrix.rawData();
-    int col_cols = col_matrix.cols;
-    for (int y = 0; y < output_height; ++y) {
-      for (int x = 0; x < output_width; ++x) {
-        int row_idx = b * (output_height * output_width) + y * output_width + x;
-        int in_y_origin = y * stride - padding;
-        int in_x_origin = x * stride - padding;
-        int col_idx = 0;
-
-        for (int c = 0; c < depth; ++c) {
-          for (int ky = 0; ky < kernel_size; ++ky) {
-            for (int kx = 0; kx < kernel_size; ++kx) {
-              int in_y = in_y_origin + ky;
-              int in_x = in_x_origin + kx;
-
-              if (in_y >= 0 && in_y < input_height && in_x >= 0 &&
-                  in_x < input_width) {
-                int flat_idx = (c * input_height * input_width) +
-                               (in_y * input_width) + in_x;
-
-                // Removed atomic: parallelized over batch so writes are
-                // thread-local
-                float grad_val =
-                    col_buf[static_cast<long long>(row_idx) * col_cols +
-                            col_idx];
-                res_row[flat_idx] += grad_val;
-              }
-              col_idx++;
-            }
-          }
-        }
+std::shared_ptr<const winograd::Filters> Conv2DLayer::winogradFilters()
+    const {
+  std::lock_guard<std::mutex> guard(winograd_cache.lock);
+  auto& cached = winograd_cache.kernels;
+  const float* w = kernels.rawData();
+  // Training changes the kernels every step; inference keeps reusing them
+  if (!winograd_cache.filters || cached.size() != kernels.size() ||
+      !std::equal(cached.begin(), cached.end(), w)) {
+    cached.assign(w, w + kernels.size());
+    winograd_cache.filters = std::make_shared<const winograd::Filters>(
+        winograd_tile, depth, static_cast<int>(filters),
+        kernelWeights(kernels, kernel_size, depth, layout));
+  }
+  return winograd_cache.filters;
+}
+
+winograd::Image Conv2DLayer::inputImage(const ConstMatrixView& input) const {
+  int H = input_height, W = input_width;
+  bool nhwc = layout == Layout::NHWC;
+  return {input.rawData(),
+          static_cast<int>(input.rows),
+          depth,
+          H,
+          W,
+          static_cast<std::ptrdiff_t>(input.stride),
+          nhwc ? 1 : H * W,
+          nhwc ? depth : 1};
+}
+
+void Conv2DLayer::convolve(const ConstMatrixView& input,
+                           const MatrixView& pixels) const {
+  gemm::Epilogue epilogue = activation.epilogue(biases.rawData());
+  if (pointwise()) {
+    // (Pixels, Depth) . (Depth, Filters), nothing to gather
+    pointwiseRuns(input, [&](int rows, gemm::Operand image, size_t first) {
+      gemm::sgemm(rows, filters, depth, image, asOperand(kernels),
+                  pixels.row(first), pixels.stride, false, epilogue);
+    });
+  } else if (winograd_tile == 0) {
+    gemm::sgemm(pixels.rows, filters, kernels.rows,
+                gemm::gather(Patches{*this, input}), asOperand(kernels),
+                pixels.rawData(), pixels.stride, false, epilogue);
+  } else {
+    winograd::conv3x3(inputImage(input), padding, *winogradFilters(),
+                      pixels.rawData(), pixels.stride, epilogue);
+  }
+  if (!activation.isElementwise()) activation.applyInPlace(pixels);
+}
+
+// --- Implicit GEMM: The Heart of High-Performance Conv2D ---
+// The im2col matrix (Batch*OH*OW, K*K*D) has one row per output pixel,
+// holding the input patch under the kernel. It is never stored: the GEMM
+// reads runs of it through this gather while packing its panels.
+void Conv2DLayer::Patches::operator()(int row, int col, int count,
+                                      float* dst) const {
+  // Signed copies of the geometry: patches hang over the padding
+  int D = layer.depth, H = layer.input_height, W = layer.input_width;
+  int K = layer.kernel_size, S = layer.stride, P = layer.padding;
+  int OW = layer.output_width, pixels = layer.output_height * OW;
+
+  const float* image = input.row(row / pixels);
+  int y0 = (row % pixels) / OW * S - P;
+  int x0 = (row % pixels) % OW * S - P;
+
+  if (layer.layout == Layout::NHWC) {
+    // Columns run (KernelY, KernelX, Depth): runs of one pixel's channels
+    int tap = col / D, c = col % D;
+    while (count > 0) {
+      int n = std::min(count, D - c);
+      int y = y0 + tap / K, x = x0 + tap % K;
+      if (y >= 0 && y < H && x >= 0 && x < W) {
+        std::copy_n(image + (y * W + x) * D + c, n, dst);
+      } else {
+        std::fill_n(dst, n, 0.0f);  // Padding
       }
+      dst += n;
+      count -= n;
+      c = 0;
+      ++tap;
+    }
+    return;
+  }
+
+  // Columns run (Depth, KernelY, KernelX): runs along one kernel row
+  int kernel_row = col / K, kx = col % K;
+  while (count > 0) {
+    int n = std::min(count, K - kx);
+    int c = kernel_row / K, y = y0 + kernel_row % K;
+    const float* src = image + (c * H + y) * W;
+    for (int i = 0; i < n; ++i) {
+      int x = x0 + kx + i;
+      dst[i] = y >= 0 && y < H && x >= 0 && x < W ? src[x] : 0.0f;
     }
+    dst += n;
+    count -= n;
+    kx = 0;
+    ++kernel_row;
   }
-  return result;
 }
 
-Matrix Conv2DLayer::forward(const Matrix& input, bool is_training) {
-  if (is_training) {
-    input_cache = input;
+// The data gradient is a convolution of dZ too: input pixel (y, x) gets
+// dZ at output pixel ((y + P - ky) / S, (x + P - kx) / S) through tap
+// (ky, kx), where that divides evenly. Rows are input pixels, columns run
+// (KernelY, KernelX, Filters).
+void Conv2DLayer::GradientPatches::operator()(int row, int col, int count,
+                                              float* dst) const {
+  int F = layer.filters, H = layer.input_height, W = layer.input_width;
+  int K = layer.kernel_size, S = layer.stride, P = layer.padding;
+  int OH = layer.output_height, OW = layer.output_width;
+
+  int b = row / (H * W);
+  int y = (row % (H * W)) / W, x = row % W;
+  int tap = col / F, f = col % F;
+  while (count > 0) {
+    int n = std::min(count, F - f);
+    int oy = y + P - tap / K, ox = x + P - tap % K;
+    if (oy >= 0 && ox >= 0 && oy % S == 0 && ox % S == 0 && oy / S < OH &&
+        ox / S < OW) {
+      std::copy_n(dZ.row((b * OH + oy / S) * OW + ox / S) + f, n, dst);
+    } else {
+      std::fill_n(dst, n, 0.0f);
+    }
+    dst += n;
+    count -= n;
+    f = 0;
+    ++tap;
   }
+}
+
+ConstMatrixView Conv2DLayer::infer(const ConstMatrixView& input,
+                                   ExecutionContext& ctx) const {
+  size_t pixels = input.rows * output_height * output_width;
+  MatrixView output =
+      ctx.buffer(this, OUTPUT, input.rows,
+                 filters * output_height * output_width);
+  MatrixView pixel_major = layout == Layout::NHWC
+                               ? pixelRows(output, filters)
+                               : ctx.buffer(this, PIXELS, pixels, filters);
+
+  // Same steps as forward(), minus the caches and profiling counters
+  convolve(input, pixel_major);
+  if (layout == Layout::NCHW) toImageMajor(pixel_major, output);
+  return output;
+}
+
+// (Batch*OH*OW, Filters) pixel-major GEMM output -> (Batch, F*OH*OW)
+void Conv2DLayer::toImageMajor(const ConstMatrixView& pixels,
+                               const MatrixView& out) const {
+  pixelsToPlanes(pixels, out, output_height * output_width, filters);
+}
 
-  // 1. Im2Col: Reshape input into columns
-  Matrix cols = im2col(input);
+// (Batch, F*OH*OW) -> (Batch*OH*OW, Filters), the inverse of toImageMajor
+void Conv2DLayer::toPixelMajor(const ConstMatrixView& image,
+                               const MatrixView& out) const {
+  planesToPixels(image, out, output_height * output_width, filters);
+}
+
+Matrix Conv2DLayer::forward(const ConstMatrixView& input, bool is_training) {
+  // The caller's input may not outlive this call: keep a copy to train on
   if (is_training) {
-    col_cache = cols;
+    input_cache.assign(input);
+    return Matrix(trainForward(input_cache, buffers));
   }
+  // Own scratch, so a training step in flight keeps its buffers
+  ExecutionContext ctx;
+  return Matrix(infer(input, ctx));
+}
 
-  // 2. Convolution via GEMM (Cols * Kernels)
+Matrix Conv2DLayer::backward(const Matrix& outputGradients) {
+  return Matrix(trainBackward(outputGradients, buffers));
+}
+
+ConstMatrixView Conv2DLayer::trainForward(const ConstMatrixView& input,
+                                          ExecutionContext& ctx) {
+  // Borrowed, not copied: backward gathers its patches from it again
+  input_view = input;
+  size_t pixels = input.rows * output_height * output_width;
+  MatrixView output =
+      ctx.buffer(this, OUTPUT, input.rows,
+                 filters * output_height * output_width);
+  MatrixView pixel_major = layout == Layout::NHWC
+                               ? pixelRows(output, filters)
+                               : ctx.buffer(this, PIXELS, pixels, filters);
+
+  // 1. Convolution via implicit GEMM, patches gathered straight from the
+  // input, with bias and activation fused in:
   // (Batch*OH*OW, K*K*D) . (K*K*D, Filters) -> (Batch*OH*OW, Filters)
+  // Biases are per filter, i.e. per column, so they broadcast down rows.
+  // 3x3 stride-1 layers use Winograd instead (see core/Winograd.hpp).
   auto t_gemm = std::chrono::steady_clock::now();
-  // Transpose kernels into a reusable buffer, then multiply using B^T path
-  kernels.transpose(kernels_T);
-  Matrix output_flat;
-  cols.dotWithBTransposed(kernels_T, output_flat);
-  profiling_gemm += std::chrono::duration_cast<std::chrono::duration<double>>(
-                        std::chrono::steady_clock::now() - t_gemm)
-                        .count();
-
-  // 3. Reshape Output to (Batch, Filters*OH*OW) and Add Bias
-  // Since we don't have a 3D Tensor class, we keep it flattened (Batch,
-  // F*OH*OW) However, the biases need to be added per-filter. Our flat output
-  // is organized as pixel-major, then batch. We need to carefully add biases.
-
-  // Simple approach: Iterate and add bias
-  int pixels = output_height * output_width;
-  auto t_bias = std::chrono::steady_clock::now();
-  // Use optimized broadcast add (vectorized + parallel)
-  output_flat += biases;
-  profiling_bias += std::chrono::duration_cast<std::chrono::duration<double>>(
-                        std::chrono::steady_clock::now() - t_bias)
-                        .count();
-
-  // 4. Activation
-  z_cache = output_flat;  // Store Z for backprop
-  auto t_act = std::chrono::steady_clock::now();
-  Matrix a = activation.apply(z_cache);
-  profiling_activation +=
-      std::chrono::duration_cast<std::chrono::duration<double>>(
-          std::chrono::steady_clock::now() - t_act)
-          .count();
-
-  if (is_training) a_cache = a;
-
-  // Note: The output is strictly 2D (Rows=Batch*Pix, Cols=Filters)
-  // If the next layer expects (Batch, Flattened), we need to reshape.
-  // But our 'im2col' flattened the batch dimension too.
-  // We must reshape back to (Batch, TotalFlatSize).
-
-  auto t_reshape = std::chrono::steady_clock::now();
-  Matrix final_output(input.rows, filters * pixels);
-
-  // Parallelize over batch and filter to improve cache behaviour
-#pragma omp parallel for collapse(2)
-  for (int b = 0; b < input.rows; ++b) {
-    for (int f = 0; f < filters; ++f) {
-      float* dest =
-          final_output.rawData() + (b * (filters * pixels) + f * pixels);
-      const float* src = a.rawData() + ((b * pixels) * filters + f);
-      for (int p = 0; p < pixels; ++p) dest[p] = src[p * filters];
-    }
+  convolve(input, pixel_major);
+  profiling_gemm += secondsSince(t_gemm);
+
+  // 2. The GEMM flattened the batch into its rows: back to (Batch,
+  // TotalFlatSize) for the next layer. In NHWC those rows already are the
+  // output. Backprop only needs this output.
+  if (layout == Layout::NCHW) {
+    auto t_reshape = std::chrono::steady_clock::now();
+    toImageMajor(pixel_major, output);
+    profiling_reshape += secondsSince(t_reshape);
   }
 
-  profiling_reshape +=
-      std::chrono::duration_cast<std::chrono::duration<double>>(
-          std::chrono::steady_clock::now() - t_reshape)
-          .count();
-
-  return final_output;
+  output_view = output;
+  return output;
 }
 
-Matrix Conv2DLayer::backward(const Matrix& outputGradients) {
-  // outputGradients comes in as (Batch, Filters*Pixels).
-  // We need to reshape it back to (Batch*Pixels, Filters) for im2col compatible
-  // math.
-  int pixels = output_height * output_width;
-  Matrix dZ_flat(outputGradients.rows * pixels, filters);
-
-  int flat_row = 0;
-  for (int b = 0; b < outputGradients.rows; ++b) {
-    for (int p = 0; p < pixels; ++p) {
-      for (int f = 0; f < filters; ++f) {
-        dZ_flat(flat_row, f) = outputGradients(b, f * pixels + p);
-      }
-      flat_row++;
-    }
-  }
+ConstMatrixView Conv2DLayer::trainBackward(
+    const ConstMatrixView& outputGradients, ExecutionContext& ctx) {
+  size_t batch = output_view.rows;
+  size_t pixels = batch * output_height * output_width;
 
-  // 1. Activation Derivative
-  // Reconstruct Z_cache if needed, or use a_cache depending on activation
-  Matrix dZ;
+  // 1. Activation Derivative, into pixel-major dZ (Batch*Pixels, Filters).
+  // NHWC gradients arrive pixel-major already. For NCHW, element-wise
+  // activations are applied in the image-major layout the gradient arrives
+  // in; softmax works on each pixel's filters, so both sides are
+  // transposed first.
   auto t_actback = std::chrono::steady_clock::now();
-  activation.backprop(a_cache, dZ_flat,
-                      dZ);  // dZ is now (Batch*Pixels, Filters)
-  profiling_act_backprop +=
-      std::chrono::duration_cast<std::chrono::duration<double>>(
-          std::chrono::steady_clock::now() - t_actback)
-          .count();
+  MatrixView dZ = ctx.buffer(this, DZ, pixels, filters);
+  if (layout == Layout::NHWC) {
+    activation.backprop(pixelRows(output_view, filters),
+                        pixelRows(outputGradients, filters), dZ);
+  } else if (activation.isElementwise()) {
+    MatrixView scratch = ctx.buffer(this, SCRATCH, pixels, filters);
+    MatrixView dZ_image(scratch.rawData(), batch, output_view.cols);
+    activation.backprop(output_view, outputGradients, dZ_image);
+    toPixelMajor(dZ_image, dZ);
+  } else {
+    MatrixView scratch = ctx.buffer(this, SCRATCH, pixels, filters);
+    MatrixView a = ctx.buffer(this, A_PIXELS, pixels, filters);
+    toPixelMajor(output_view, a);
+    toPixelMajor(outputGradients, scratch);
+    activation.backprop(a, scratch, dZ);
+  }
+  profiling_act_backprop += secondsSince(t_actback);
 
   // 2. Gradients w.r.t Weights (Kernels)
-  // dW = Col_X^T * dZ
+  // dW = Col_X^T * dZ, the columns gathered from the input again
   // (K*K*D, Batch*Pixels) . (Batch*Pixels, Filters) -> (K*K*D, Filters)
-  // Reuse pre-allocated transpose buffer
-  col_cache.transpose(this->col_T);
   auto t_kgrad = std::chrono::steady_clock::now();
-  this->col_T.dot(dZ, kernels_grad);
-  profiling_kernels_grad +=
-      std::chrono::duration_cast<std::chrono::duration<double>>(
-          std::chrono::steady_clock::now() - t_kgrad)
-          .count();
+  if (pointwise()) {
+    // X^T . dZ over the input pixels in place, summed run by run
+    pointwiseRuns(input_view, [&](int rows, gemm::Operand image,
+                                  size_t first) {
+      gemm::Operand transposed{image.data, image.col_stride,
+                               image.row_stride};
+      gemm::Operand dZ_run{dZ.row(first),
+                           static_cast<std::ptrdiff_t>(dZ.stride), 1};
+      gemm::sgemm(depth, filters, rows, transposed, dZ_run,
+                  kernels_grad.rawData(), kernels_grad.cols, first > 0);
+    });
+  } else {
+    gemm::sgemm(kernels.rows, filters, pixels,
+                gemm::gather(Patches{*this, input_view}, true), asOperand(dZ),
+                kernels_grad.rawData(), kernels_grad.cols);
+  }
+  profiling_kernels_grad += secondsSince(t_kgrad);
 
   // 3. Gradients w.r.t Biases
   // Sum dZ across all batches and pixels
-  biases_grad.fill(0.0f);
   auto t_bgrad = std::chrono::steady_clock::now();
-  dZ.reduceToRow(biases_grad);
-  profiling_bias_grad +=
-      std::chrono::duration_cast<std::chrono::duration<double>>(
-          std::chrono::steady_clock::now() - t_bgrad)
-          .count();
-
-  // 4. Gradients w.r.t Input (dX)
-  // dCol = dZ * W^T
-  auto t_dcol = std::chrono::steady_clock::now();
-  Matrix dCol;
-  // Use kernels directly as B_T here (rows = fan_in, cols = filters) so that
-  // dotWithBTransposed sees B_T.cols == dZ.cols
-  dZ.dotWithBTransposed(kernels, dCol);
-  profiling_dcol += std::chrono::duration_cast<std::chrono::duration<double>>(
-                        std::chrono::steady_clock::now() - t_dcol)
-                        .count();
-
-  // 5. Col2Im (Reshape back to image)
-  auto t_col2im = std::chrono::steady_clock::now();
-  Matrix res = col2im(dCol);
-  profiling_col2im += std::chrono::duration_cast<std::chrono::duration<double>>(
-                          std::chrono::steady_clock::now() - t_col2im)
-                          .count();
-  return res;
+  biases_grad.fill(0.0f);
+  ConstMatrixView(dZ).reduceToRow(biases_grad);
+  profiling_bias_grad += secondsSince(t_bgrad);
+
+  // 4. Gradients w.r.t Input (dX), pixel-major
+  auto t_dx = std::chrono::steady_clock::now();
+  size_t input_pixels = batch * input_height * input_width;
+  MatrixView dX = ctx.buffer(this, INPUT_GRADIENT, batch,
+                             depth * input_height * input_width);
+  if (pointwise() && layout == Layout::NCHW) {
+    // dZ . W^T written straight into the channel planes, image by image:
+    // (Depth, Filters) . (Filters, H*W) -> (Depth, H*W)
+    int plane = input_height * input_width;
+    for (size_t b = 0; b < batch; ++b) {
+      gemm::Operand dZ_t{dZ.row(b * plane), 1,
+                         static_cast<std::ptrdiff_t>(dZ.stride)};
+      gemm::sgemm(depth, plane, filters, asOperand(kernels), dZ_t, dX.row(b),
+                  plane);
+    }
+    profiling_dcol += secondsSince(t_dx);
+    return dX;
+  }
+  MatrixView dX_pixels =
+      layout == Layout::NHWC
+          ? pixelRows(dX, depth)
+          : ctx.buffer(this, DX_PIXELS, input_pixels, depth);
+
+  if (pointwise()) {
+    // dZ . W^T: (Batch*H*W, Filters) . (Filters, Depth)
+    gemm::Operand kernels_t{kernels.rawData(), 1,
+                            static_cast<std::ptrdiff_t>(filters)};
+    gemm::sgemm(input_pixels, depth, filters, asOperand(dZ), kernels_t,
+                dX_pixels.rawData(), dX_pixels.stride);
+  } else if (winogradBackward()) {
+    // A 3x3 stride-1 convolution of dZ, padded by 2 - P, with the kernels
+    // flipped and their channels swapped: Winograd again
+    winograd::Weights w = kernelWeights(kernels, kernel_size, depth, layout);
+    winograd::Weights flipped{w.data + 2 * w.y + 2 * w.x, -w.y, -w.x,
+                              w.c_out, w.c_in};
+    winograd::Filters transformed(
+        winograd::pickTile(input_height, input_width),
+        static_cast<int>(filters), depth, flipped);
+    int OH = output_height, OW = output_width;
+    winograd::Image image{dZ.rawData(),
+                          static_cast<int>(batch),
+                          static_cast<int>(filters),
+                          OH,
+                          OW,
+                          static_cast<std::ptrdiff_t>(OH * OW * dZ.stride),
+                          1,
+                          static_cast<std::ptrdiff_t>(dZ.stride)};
+    winograd::conv3x3(image, 2 - static_cast<int>(padding), transformed,
+                      dX_pixels.rawData(), dX_pixels.stride, {});
+  } else {
+    // Otherwise an implicit GEMM:
+    // (Batch*H*W, K*K*F) . (K*K*F, D) -> (Batch*H*W, D), where row
+    // (ky, kx, f) of the rearranged kernels holds tap (ky, kx)'s weights
+    // from every input channel to filter f
+    int taps = kernel_size * kernel_size;
+    MatrixView flipped =
+        ctx.buffer(this, FLIPPED_KERNELS, taps * filters, depth);
+    for (int tap = 0; tap < taps; ++tap) {
+      for (int c = 0; c < depth; ++c) {
+        int row = layout == Layout::NHWC ? tap * depth + c : c * taps + tap;
+        const float* w = kernels.rawData() + row * filters;
+        for (size_t f = 0; f < filters; ++f) {
+          flipped(tap * filters + f, c) = w[f];
+        }
+      }
+    }
+    gemm::sgemm(input_pixels, depth, flipped.rows,
+                gemm::gather(GradientPatches{*this, dZ}), asOperand(flipped),
+                dX_pixels.rawData(), dX_pixels.stride);
+  }
+  if (layout == Layout::NCHW) {
+    pixelsToPlanes(dX_pixels, dX, input_height * input_width, depth);
+  }
+  profiling_dcol += secondsSince(t_dx);
+  return dX;
+}
+
+std::vector<BufferRequest> Conv2DLayer::trainingBuffers(size_t batch) const {
+  size_t pixels = batch * output_height * output_width;
+  size_t input_size = batch * depth * input_height * input_width;
+  // NHWC needs no reshapes, so none of their scratch
+  bool nchw = layout == Layout::NCHW;
+  size_t reshaped = nchw ? pixels * filters : 0;
+  // Pointwise layers multiply by the kernels as they are, and write NCHW
+  // data gradients straight into their planes
+  bool flips = !pointwise() && !winogradBackward();
+  bool dx_pixels = nchw && !pointwise();
+  size_t a_pixels = activation.isElementwise() ? 0 : reshaped;
+  return {
+      {PIXELS, reshaped, BufferLifetime::FORWARD},
+      {OUTPUT, pixels * filters, BufferLifetime::SAVED},
+      {SCRATCH, reshaped, BufferLifetime::BACKWARD},
+      {A_PIXELS, a_pixels, BufferLifetime::BACKWARD},
+      {DZ, pixels * filters, BufferLifetime::BACKWARD},
+      {FLIPPED_KERNELS, flips ? kernels.size() : 0, BufferLifetime::BACKWARD},
+      {DX_PIXELS, dx_pixels ? input_size : 0, BufferLifetime::BACKWARD},
+      {INPUT_GRADIENT, input_size, BufferLifetime::INPUT_GRADIENT},
+  };
 }
 
 std::vector<Matrix*> Conv2DLayer::getParameters() {
@@ -389,6 +613,10 @@ std::string Conv2DLayer::info() const {
   ss << "Conv2D Layer [" << input_height << "x" << input_width << "x" << depth
      << "] -> [" << output_height << "x" << output_width << "x" << filters
      << "] k=" << kernel_size << " s=" << stride << " p=" << padding;
+  if (layout == Layout::NHWC) ss << " NHWC";
+  if (winograd_tile > 0) {
+    ss << " winograd F(" << winograd_tile << "x" << winograd_tile << ",3x3)";
+  }
   return ss.str();
 }
 
@@ -0,0 +1,88 @@
+#include "talawa/neuralnetwork/DataParallelTrainer.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#include "talawa/core/Error.hpp"
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Parallel.hpp"
+
+namespace talawa {
+namespace nn {
+
+namespace {
+// Floats summed per all-reduce task
+constexpr std::ptrdiff_t REDUCE_GRAIN = 1 << 14;
+}  // namespace
+
+DataParallelTrainer::DataParallelTrainer(NeuralNetwork& network, int replicas)
+    : network(network) {
+  if (replicas <= 0) replicas = core::parallel::threadBudget();
+  for (int r = 1; r < replicas; ++r) clones.push_back(network.clone());
+}
+
+float DataParallelTrainer::train(const core::ConstMatrixView& input,
+                                 const core::ConstMatrixView& target) {
+  if (input.rows != target.rows || input.rows == 0) {
+    THROW_talawa_ERROR(DataParallelTrainer,
+                       "Batch of " << input.rows << " inputs and "
+                                   << target.rows << " targets");
+  }
+  size_t batch = input.rows;
+  size_t shards = std::clamp<size_t>(batch / MIN_SHARD_ROWS, 1,
+                                     static_cast<size_t>(replicaCount()));
+
+  size_t count = static_cast<size_t>(network.getTotalParameters());
+  std::vector<float> losses(shards);
+
+  // 1. Every replica trains on its own rows at the same time
+  core::parallel::parallelFor(0, shards, 1, [&](auto first, auto last) {
+    const auto& k = core::kernels::active();
+    for (auto r = first; r < last; ++r) {
+      NeuralNetwork& net = replica(r);
+      size_t lo = batch * r / shards, hi = batch * (r + 1) / shards;
+
+      // Start from the network's current weights
+      if (r > 0) {
+        std::copy_n(network.parameterData(), count, net.parameterData());
+      }
+
+      losses[r] = net.computeGradients(input.rowRange(lo, hi),
+                                       target.rowRange(lo, hi));
+
+      // Losses average over their rows: weight by this shard's share so the
+      // sum over replicas is the full-batch gradient
+      float share = static_cast<float>(hi - lo) / static_cast<float>(batch);
+      losses[r] *= share;
+      k.scale(net.gradientData(), share, count);
+    }
+  });
+
+  // 2. Combine into the network's gradients, then one optimizer step
+  allReduce(shards);
+  network.applyGradients();
+
+  float loss = 0.0f;
+  for (float l : losses) loss += l;
+  return loss;
+}
+
+void DataParallelTrainer::allReduce(size_t shards) {
+  if (shards < 2) return;
+
+  // Split the gradient arena evenly, so each task sums one slice across
+  // every replica (a reduce-scatter in shared memory)
+  float* dst = network.gradientData();
+  core::parallel::parallelFor(
+      0, network.getTotalParameters(), REDUCE_GRAIN,
+      [&](auto first, auto last) {
+        const auto& k = core::kernels::active();
+        for (size_t r = 1; r < shards; ++r) {
+          k.add(dst + first, replica(r).gradientData() + first, last - first);
+        }
+      });
+}
+
+}  // namespace nn
+}  // namespace talawa
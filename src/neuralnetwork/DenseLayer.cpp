@@ -6,6 +6,12 @@
 
 namespace talawa {
 namespace nn {
+
+namespace {
+// Training buffers (see trainingBuffers)
+enum Slot { OUTPUT, DZ, INPUT_GRADIENT };
+}  // namespace
+
 // Default constructor for load-time construction
 DenseLayer::DenseLayer() : in(0), out(0) {}
 
@@ -94,51 +100,68 @@ void DenseLayer::load(std::istream& in_stream) {
   this->biases_grad = Matrix(1, static_cast<int>(out_dim));
 }
 
-Matrix DenseLayer::forward(const Matrix& input, bool is_training) {
+Matrix DenseLayer::forward(const ConstMatrixView& input, bool is_training) {
+  // The caller's input may not outlive this call: keep a copy to train on
   if (is_training) {
-    this->input_cache = input;
-  }
-
-  // Ensure Cache is Ready (Allocate ONCE, reuse forever)
-  if (z_cache.rows != input.rows || z_cache.cols != out) {
-    z_cache = Matrix(input.rows, out);
+    this->input_cache.assign(input);
+    return Matrix(trainForward(input_cache, buffers));
   }
 
-  // Z - WX+b
-  input.dot(weights, z_cache);
-  z_cache += biases;
+  // A = Activation(XW + b), fused into a single pass over the output
+  Matrix a;
+  activation.applyAffine(input, weights, biases, a);
+  return a;
+}
 
-  // A - Activation(Z)
-  auto a = activation.apply(z_cache);
+Matrix DenseLayer::backward(const Matrix& outputGradients) {
+  return Matrix(trainBackward(outputGradients, buffers));
+}
 
-  if (is_training) {
-    this->a_cache = a;
-  }
+ConstMatrixView DenseLayer::infer(const ConstMatrixView& input,
+                                  ExecutionContext& ctx) const {
+  MatrixView a = ctx.buffer(this, 0, input.rows, out);
+  input.dot(weights, a, activation.epilogue(biases.rawData()));
+  if (!activation.isElementwise()) activation.applyInPlace(a);
+  return a;
+}
 
+ConstMatrixView DenseLayer::trainForward(const ConstMatrixView& input,
+                                         ExecutionContext& ctx) {
+  // A = Activation(XW + b), fused into a single pass over the output.
+  // Backprop only needs X (borrowed, not copied) and A, so Z is never stored.
+  input_view = input;
+  MatrixView a = ctx.buffer(this, OUTPUT, input.rows, out);
+  input.dot(weights, a, activation.epilogue(biases.rawData()));
+  if (!activation.isElementwise()) activation.applyInPlace(a);
+  a_view = a;
   return a;
 }
 
-Matrix DenseLayer::backward(const Matrix& outputGradients) {
+ConstMatrixView DenseLayer::trainBackward(
+    const ConstMatrixView& outputGradients, ExecutionContext& ctx) {
+  size_t rows = a_view.rows;
+
   // 1. Calculate dL/dZ (Gradient through Activation)
-  activation.backprop(a_cache, outputGradients, this->dZ);
+  MatrixView dZ = ctx.buffer(this, DZ, rows, out);
+  activation.backprop(a_view, outputGradients, dZ);
 
-  // dW = X^T * dZ
-  input_cache.transpose(this->input_T_cache);
-  input_T_cache.dot(this->dZ, this->weights_grad);
+  // dW = X^T * dZ (X read in place, no transposed copy)
+  input_view.dotTN(dZ, weights_grad);
 
   // dB = sum(dZ, axis=0)
   biases_grad.fill(0.0f);
-  this->dZ.reduceToRow(biases_grad);
+  ConstMatrixView(dZ).reduceToRow(biases_grad);
 
   // dX = dZ * W^T
-  weights.transpose(this->weights_T_cache);
-  if (input_gradients_cache.rows != dZ.rows ||
-      input_gradients_cache.cols != in) {
-    input_gradients_cache = Matrix(dZ.rows, in);
-  }
-  this->dZ.dot(this->weights_T_cache, input_gradients_cache);
+  MatrixView dX = ctx.buffer(this, INPUT_GRADIENT, rows, in);
+  ConstMatrixView(dZ).dotNT(weights, dX);
+  return dX;
+}
 
-  return input_gradients_cache;
+std::vector<BufferRequest> DenseLayer::trainingBuffers(size_t batch) const {
+  return {{OUTPUT, batch * out, BufferLifetime::SAVED},
+          {DZ, batch * out, BufferLifetime::BACKWARD},
+          {INPUT_GRADIENT, batch * in, BufferLifetime::INPUT_GRADIENT}};
 }
 
 // --- Optimizers  ---
@@ -0,0 +1,352 @@
+#include "talawa/neuralnetwork/DepthwiseConv2DLayer.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Parallel.hpp"
+
+namespace talawa::nn {
+
+using namespace core;
+
+namespace {
+// Training buffers (see trainingBuffers). infer() uses the first.
+enum Slot { OUTPUT, DZ, INPUT_GRADIENT };
+
+// NHWC weight gradients are split across threads by channel
+constexpr int CHANNEL_BLOCK = 16;
+}  // namespace
+
+// Default constructor for load-time construction
+DepthwiseConv2DLayer::DepthwiseConv2DLayer(Layout layout)
+    : depth(0),
+      input_height(0),
+      input_width(0),
+      kernel_size(0),
+      stride(0),
+      padding(0),
+      output_height(0),
+      output_width(0),
+      layout(layout) {}
+
+DepthwiseConv2DLayer::DepthwiseConv2DLayer(int d, int h, int w, int k, int s,
+                                           int p, Initializer init,
+                                           Activation act, Layout layout)
+    : depth(d),
+      input_height(h),
+      input_width(w),
+      kernel_size(k),
+      stride(s),
+      padding(p),
+      layout(layout) {
+  this->initializer = init;
+  this->activation = act;
+  // Each output pixel only sees its own channel: normalising across them
+  // would mix what the layer keeps apart
+  if (!activation.isElementwise()) {
+    THROW_talawa_ERROR(DepthwiseConv2DLayer,
+                       "Depthwise convolutions need an element-wise "
+                       "activation, got "
+                           << activation.getName());
+  }
+
+  // 1. Calculate Output Dimensions
+  output_height = (input_height - kernel_size + 2 * padding) / stride + 1;
+  output_width = (input_width - kernel_size + 2 * padding) / stride + 1;
+
+  // 2. Initialize Kernels, one column per channel. The fans are those of a
+  // single channel's kernel (K*K in, K*K out), not of the whole matrix.
+  int taps = kernel_size * kernel_size;
+  kernels = Matrix(taps, depth);
+  Matrix fan(taps, taps);
+  for (int c = 0; c < depth; c += taps) {
+    initializer.apply(fan);
+    for (int t = 0; t < taps; ++t) {
+      for (int j = 0; j < taps && c + j < depth; ++j) {
+        kernels(t, c + j) = fan(t, j);
+      }
+    }
+  }
+
+  // 3. Initialize Biases (1, Depth)
+  biases = Matrix(1, depth);
+  Initializer(Initializer::ZEROS).apply(biases);
+
+  // 4. Pre-allocate Gradients
+  kernels_grad = Matrix(taps, depth);
+  biases_grad = Matrix(1, depth);
+}
+
+void DepthwiseConv2DLayer::save(std::ostream& out) const {
+  // Save configuration
+  out.write(reinterpret_cast<const char*>(&depth), sizeof(int));
+  out.write(reinterpret_cast<const char*>(&input_height), sizeof(int));
+  out.write(reinterpret_cast<const char*>(&input_width), sizeof(int));
+  out.write(reinterpret_cast<const char*>(&kernel_size), sizeof(int));
+  out.write(reinterpret_cast<const char*>(&stride), sizeof(int));
+  out.write(reinterpret_cast<const char*>(&padding), sizeof(int));
+
+  int act = static_cast<int>(activation.type);
+  out.write(reinterpret_cast<const char*>(&act), sizeof(int));
+
+  // Save kernels, then biases
+  for (const Matrix* m : {&kernels, &biases}) {
+    size_t rows = m->rows;
+    size_t cols = m->cols;
+    out.write(reinterpret_cast<const char*>(&rows), sizeof(size_t));
+    out.write(reinterpret_cast<const char*>(&cols), sizeof(size_t));
+    out.write(reinterpret_cast<const char*>(m->rawData()),
+              rows * cols * sizeof(float));
+  }
+}
+
+void DepthwiseConv2DLayer::load(std::istream& in_stream) {
+  in_stream.read(reinterpret_cast<char*>(&depth), sizeof(int));
+  in_stream.read(reinterpret_cast<char*>(&input_height), sizeof(int));
+  in_stream.read(reinterpret_cast<char*>(&input_width), sizeof(int));
+  in_stream.read(reinterpret_cast<char*>(&kernel_size), sizeof(int));
+  in_stream.read(reinterpret_cast<char*>(&stride), sizeof(int));
+  in_stream.read(reinterpret_cast<char*>(&padding), sizeof(int));
+
+  // Activation
+  int act;
+  in_stream.read(reinterpret_cast<char*>(&act), sizeof(int));
+  this->activation = Activation(static_cast<Activation::Type>(act));
+
+  // Recompute output sizes
+  output_height = (input_height - kernel_size + 2 * padding) / stride + 1;
+  output_width = (input_width - kernel_size + 2 * padding) / stride + 1;
+
+  // Read kernels, then biases
+  for (Matrix* m : {&kernels, &biases}) {
+    size_t rows, cols;
+    in_stream.read(reinterpret_cast<char*>(&rows), sizeof(size_t));
+    in_stream.read(reinterpret_cast<char*>(&cols), sizeof(size_t));
+    *m = Matrix(static_cast<int>(rows), static_cast<int>(cols));
+    in_stream.read(reinterpret_cast<char*>(m->rawData()),
+                   rows * cols * sizeof(float));
+  }
+
+  // Recreate gradients
+  kernels_grad = Matrix(kernel_size * kernel_size, depth);
+  biases_grad = Matrix(1, depth);
+}
+
+// --- Sliding window, one channel at a time ---
+// Every output row is the bias plus, for each kernel row over the image,
+// that kernel row slid along the matching input row (kernels::depthwise_row).
+// NHWC rows hold all channels of a pixel together and vectorise across
+// them; NCHW planes run channel by channel and vectorise along the row.
+void DepthwiseConv2DLayer::convolve(const ConstMatrixView& input,
+                                    const MatrixView& output) const {
+  const auto& k = kernels::active();
+  // Element-wise f applied to each output row while it is still in cache
+  auto act = activation.epilogue(nullptr).activation;
+  int D = depth, H = input_height, W = input_width;
+  int K = kernel_size, S = stride, P = padding;
+  int OH = output_height, OW = output_width;
+  const float* w = kernels.rawData();
+  const float* bias = biases.rawData();
+
+  if (layout == Layout::NHWC) {
+    kernels::DepthwiseRow row{D, D, D, W, OW, K, S, P};
+    parallel::parallelFor(0, input.rows * OH, 1, [&](auto first, auto last) {
+      for (auto r = first; r < last; ++r) {
+        int b = r / OH, oy = r % OH;
+        float* out = output.row(b) + oy * OW * D;
+        for (int ox = 0; ox < OW; ++ox) std::copy_n(bias, D, out + ox * D);
+        for (int ky = 0; ky < K; ++ky) {
+          int y = oy * S - P + ky;
+          if (y < 0 || y >= H) continue;  // Padding
+          k.depthwise_row(out, input.row(b) + y * W * D, w + ky * K * D, row);
+        }
+        if (act) act(out, OW * D);
+      }
+    });
+    return;
+  }
+
+  kernels::DepthwiseRow row{1, 1, D, W, OW, K, S, P};
+  parallel::parallelFor(0, input.rows * D, 1, [&](auto first, auto last) {
+    for (auto i = first; i < last; ++i) {
+      int b = i / D, c = i % D;
+      const float* plane = input.row(b) + c * H * W;
+      float* out = output.row(b) + c * OH * OW;
+      for (int oy = 0; oy < OH; ++oy) {
+        float* out_row = out + oy * OW;
+        std::fill_n(out_row, OW, bias[c]);
+        for (int ky = 0; ky < K; ++ky) {
+          int y = oy * S - P + ky;
+          if (y < 0 || y >= H) continue;
+          k.depthwise_row(out_row, plane + y * W, w + ky * K * D + c, row);
+        }
+      }
+      if (act) act(out, OH * OW);
+    }
+  });
+}
+
+ConstMatrixView DepthwiseConv2DLayer::infer(const ConstMatrixView& input,
+                                            ExecutionContext& ctx) const {
+  MatrixView output = ctx.buffer(this, OUTPUT, input.rows,
+                                 depth * output_height * output_width);
+  convolve(input, output);
+  return output;
+}
+
+Matrix DepthwiseConv2DLayer::forward(const ConstMatrixView& input,
+                                     bool is_training) {
+  // The caller's input may not outlive this call: keep a copy to train on
+  if (is_training) {
+    input_cache.assign(input);
+    return Matrix(trainForward(input_cache, buffers));
+  }
+  ExecutionContext ctx;
+  return Matrix(infer(input, ctx));
+}
+
+Matrix DepthwiseConv2DLayer::backward(const Matrix& outputGradients) {
+  return Matrix(trainBackward(outputGradients, buffers));
+}
+
+ConstMatrixView DepthwiseConv2DLayer::trainForward(
+    const ConstMatrixView& input, ExecutionContext& ctx) {
+  // Borrowed, not copied: backward slides over it again for dW
+  input_view = input;
+  output_view = infer(input, ctx);
+  return output_view;
+}
+
+ConstMatrixView DepthwiseConv2DLayer::trainBackward(
+    const ConstMatrixView& outputGradients, ExecutionContext& ctx) {
+  const auto& k = kernels::active();
+  size_t batch = output_view.rows;
+  int D = depth, H = input_height, W = input_width;
+  int K = kernel_size, S = stride, P = padding;
+  int OH = output_height, OW = output_width;
+  const ConstMatrixView input = input_view;
+
+  // 1. Activation Derivative: element-wise, so either layout as it is
+  MatrixView dZ = ctx.buffer(this, DZ, batch, output_view.cols);
+  activation.backprop(output_view, outputGradients, dZ);
+
+  // 2. Gradients w.r.t Weights and Biases, summed over the batch. Each
+  // task owns a set of channels, so no two write the same gradient.
+  kernels_grad.fill(0.0f);
+  biases_grad.fill(0.0f);
+  float* dw = kernels_grad.rawData();
+  if (layout == Layout::NHWC) {
+    int blocks = (D + CHANNEL_BLOCK - 1) / CHANNEL_BLOCK;
+    parallel::parallelFor(0, blocks, 1, [&](auto first, auto last) {
+      for (auto blk = first; blk < last; ++blk) {
+        int c0 = blk * CHANNEL_BLOCK;
+        int n = std::min(CHANNEL_BLOCK, D - c0);
+        kernels::DepthwiseRow row{n, D, D, W, OW, K, S, P};
+        for (size_t b = 0; b < batch; ++b) {
+          for (int oy = 0; oy < OH; ++oy) {
+            const float* dz = dZ.row(b) + oy * OW * D + c0;
+            for (int ky = 0; ky < K; ++ky) {
+              int y = oy * S - P + ky;
+              if (y < 0 || y >= H) continue;
+              k.depthwise_row_weight_grad(dw + ky * K * D + c0, dz,
+                                          input.row(b) + y * W * D + c0, row);
+            }
+          }
+        }
+      }
+    });
+    ConstMatrixView(dZ.rawData(), batch * OH * OW, D).reduceToRow(biases_grad);
+  } else {
+    kernels::DepthwiseRow row{1, 1, D, W, OW, K, S, P};
+    parallel::parallelFor(0, D, 1, [&](auto first, auto last) {
+      for (auto c = first; c < last; ++c) {
+        for (size_t b = 0; b < batch; ++b) {
+          const float* dz = dZ.row(b) + c * OH * OW;
+          const float* plane = input.row(b) + c * H * W;
+          biases_grad(0, c) += k.sum(dz, OH * OW);
+          for (int oy = 0; oy < OH; ++oy) {
+            for (int ky = 0; ky < K; ++ky) {
+              int y = oy * S - P + ky;
+              if (y < 0 || y >= H) continue;
+              k.depthwise_row_weight_grad(dw + ky * K * D + c, dz + oy * OW,
+                                          plane + y * W, row);
+            }
+          }
+        }
+      }
+    });
+  }
+
+  // 3. Gradients w.r.t Input: every output row scatters back through the
+  // kernel rows it was computed from (kernels::depthwise_row_input_grad)
+  MatrixView dX = ctx.buffer(this, INPUT_GRADIENT, batch, D * H * W);
+  const float* w = kernels.rawData();
+  auto scatter = [&](float* dx, const float* dz, const float* wc,
+                     const kernels::DepthwiseRow& row, int pixel_floats) {
+    std::fill_n(dx, H * W * pixel_floats, 0.0f);
+    for (int oy = 0; oy < OH; ++oy) {
+      for (int ky = 0; ky < K; ++ky) {
+        int y = oy * S - P + ky;
+        if (y < 0 || y >= H) continue;
+        k.depthwise_row_input_grad(dx + y * W * pixel_floats,
+                                   dz + oy * OW * pixel_floats,
+                                   wc + ky * K * D, row);
+      }
+    }
+  };
+  if (layout == Layout::NHWC) {
+    kernels::DepthwiseRow row{D, D, D, W, OW, K, S, P};
+    parallel::parallelFor(0, batch, 1, [&](auto first, auto last) {
+      for (auto b = first; b < last; ++b) {
+        scatter(dX.row(b), dZ.row(b), w, row, D);
+      }
+    });
+  } else {
+    kernels::DepthwiseRow row{1, 1, D, W, OW, K, S, P};
+    parallel::parallelFor(0, batch * D, 1, [&](auto first, auto last) {
+      for (auto i = first; i < last; ++i) {
+        int b = i / D, c = i % D;
+        scatter(dX.row(b) + c * H * W, dZ.row(b) + c * OH * OW, w + c, row,
+                1);
+      }
+    });
+  }
+  return dX;
+}
+
+std::vector<BufferRequest> DepthwiseConv2DLayer::trainingBuffers(
+    size_t batch) const {
+  size_t out_size = batch * depth * output_height * output_width;
+  size_t in_size = batch * depth * input_height * input_width;
+  return {
+      {OUTPUT, out_size, BufferLifetime::SAVED},
+      {DZ, out_size, BufferLifetime::BACKWARD},
+      {INPUT_GRADIENT, in_size, BufferLifetime::INPUT_GRADIENT},
+  };
+}
+
+std::vector<Matrix*> DepthwiseConv2DLayer::getParameters() {
+  return {&kernels, &biases};
+}
+
+std::vector<Matrix*> DepthwiseConv2DLayer::getParameterGradients() {
+  return {&kernels_grad, &biases_grad};
+}
+
+Shape DepthwiseConv2DLayer::getOutputShape() const {
+  return {static_cast<size_t>(depth), static_cast<size_t>(output_height),
+          static_cast<size_t>(output_width)};
+}
+
+std::string DepthwiseConv2DLayer::info() const {
+  std::stringstream ss;
+  ss << "DepthwiseConv2D Layer [" << input_height << "x" << input_width << "x"
+     << depth << "] -> [" << output_height << "x" << output_width << "x"
+     << depth << "] k=" << kernel_size << " s=" << stride
+     << " p=" << padding;
+  if (layout == Layout::NHWC) ss << " NHWC";
+  return ss.str();
+}
+
+}  // namespace talawa::nn
@@ -0,0 +1,465 @@
+#include "talawa/neuralnetwork/DistributedTrainer.hpp"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "talawa/core/Error.hpp"
+#include "talawa/core/Kernels.hpp"
+
+namespace talawa {
+namespace nn {
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+[[noreturn]] void fail(const std::string& what) {
+  throw std::runtime_error("DistributedTrainer: " + what + " (" +
+                           std::strerror(errno) + ")");
+}
+
+// Closes a rendezvous socket on every way out, including a throw
+struct SocketGuard {
+  int fd;
+  explicit SocketGuard(int fd) : fd(fd) {}
+  SocketGuard(SocketGuard&& other) noexcept : fd(other.fd) { other.fd = -1; }
+  SocketGuard& operator=(SocketGuard&&) = delete;
+  ~SocketGuard() {
+    if (fd >= 0) ::close(fd);
+  }
+};
+
+int msLeft(Clock::time_point deadline) {
+  auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - Clock::now());
+  return static_cast<int>(std::max<long long>(0, left.count()));
+}
+
+int listenOn(int port) {
+  int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) fail("socket");
+  int on = 1;
+  ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(static_cast<uint16_t>(port));
+  if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+      ::listen(fd, SOMAXCONN) < 0) {
+    ::close(fd);
+    fail("cannot listen on port " + std::to_string(port));
+  }
+  return fd;
+}
+
+uint32_t portOf(int fd) {
+  sockaddr_in addr{};
+  socklen_t len = sizeof(addr);
+  if (::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) < 0) {
+    fail("getsockname");
+  }
+  return ntohs(addr.sin_port);
+}
+
+int acceptWithin(int fd, Clock::time_point deadline, sockaddr_in* peer) {
+  pollfd p{fd, POLLIN, 0};
+  int ready;
+  do {
+    ready = ::poll(&p, 1, msLeft(deadline));
+  } while (ready < 0 && errno == EINTR);
+  if (ready == 0) errno = ETIMEDOUT;
+  if (ready <= 0) fail("no connection from the other workers");
+
+  sockaddr_in addr{};
+  socklen_t len = sizeof(addr);
+  int conn = ::accept(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+  if (conn < 0) fail("accept");
+  if (peer) *peer = addr;
+  return conn;
+}
+
+// Peers may not be listening yet: retry until the deadline
+int connectTo(const sockaddr_in& addr, Clock::time_point deadline) {
+  while (true) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) fail("socket");
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&addr),
+                  sizeof(addr)) == 0) {
+      return fd;
+    }
+    ::close(fd);
+    if (Clock::now() >= deadline) {
+      char host[INET_ADDRSTRLEN] = "?";
+      ::inet_ntop(AF_INET, &addr.sin_addr, host, sizeof(host));
+      fail("cannot connect to " + std::string(host) + ":" +
+           std::to_string(ntohs(addr.sin_port)));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+}
+
+sockaddr_in resolve(const std::string& host, int port) {
+  addrinfo hints{};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* found = nullptr;
+  if (::getaddrinfo(host.c_str(), nullptr, &hints, &found) != 0 || !found) {
+    throw std::runtime_error("DistributedTrainer: cannot resolve " + host);
+  }
+  sockaddr_in addr = *reinterpret_cast<sockaddr_in*>(found->ai_addr);
+  ::freeaddrinfo(found);
+  addr.sin_port = htons(static_cast<uint16_t>(port));
+  return addr;
+}
+
+// Blocking transfers, for the rendezvous
+void sendAll(int fd, const void* data, size_t bytes) {
+  auto* p = static_cast<const char*>(data);
+  while (bytes > 0) {
+    ssize_t n = ::send(fd, p, bytes, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) fail("send");
+    p += n;
+    bytes -= n;
+  }
+}
+
+void recvAll(int fd, void* data, size_t bytes) {
+  auto* p = static_cast<char*>(data);
+  while (bytes > 0) {
+    ssize_t n = ::recv(fd, p, bytes, 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n == 0) errno = ECONNRESET;
+    if (n <= 0) fail("recv");
+    p += n;
+    bytes -= n;
+  }
+}
+
+// Worker -> rank 0 at the rendezvous
+struct Hello {
+  int32_t rank;
+  uint32_t ring_port;
+};
+// Rank 0 -> workers: where every rank listens for its left neighbour
+struct Endpoint {
+  uint32_t ip;  // Network byte order; 0 = master_addr
+  uint32_t port;
+};
+
+// FNV-1a over the raw bits of every parameter
+uint64_t hashParameters(const NeuralNetwork& network) {
+  uint64_t hash = 14695981039346656037ull;
+  const float* data = network.parameterData();
+  for (int i = 0; i < network.getTotalParameters(); ++i) {
+    uint32_t bits;
+    std::memcpy(&bits, &data[i], sizeof(bits));
+    hash = (hash ^ bits) * 1099511628211ull;
+  }
+  return hash;
+}
+}  // namespace
+
+DistributedConfig DistributedConfig::fromEnv() {
+  DistributedConfig config;
+  if (const char* v = std::getenv("TALAWA_RANK")) config.rank = std::atoi(v);
+  if (const char* v = std::getenv("TALAWA_WORLD_SIZE")) {
+    config.world_size = std::atoi(v);
+  }
+  if (const char* v = std::getenv("TALAWA_MASTER_ADDR")) config.master_addr = v;
+  if (const char* v = std::getenv("TALAWA_MASTER_PORT")) {
+    config.master_port = std::atoi(v);
+  }
+  return config;
+}
+
+DistributedTrainer::DistributedTrainer(NeuralNetwork& network,
+                                       const DistributedConfig& config)
+    : network(network), config(config) {
+  if (config.world_size < 1 || config.rank < 0 ||
+      config.rank >= config.world_size) {
+    THROW_talawa_ERROR(DistributedTrainer,
+                       "Rank " << config.rank << " is outside a world of "
+                               << config.world_size << " workers");
+  }
+  if (config.world_size == 1) return;
+
+  try {
+    rendezvous();
+
+    // Every worker must have built the same network...
+    uint64_t count = network.getTotalParameters(), left_count = 0;
+    exchange(&count, sizeof(count), &left_count, sizeof(left_count));
+    float mismatch = count != left_count ? 1.0f : 0.0f;
+    allReduce(&mismatch, 1);
+    if (mismatch != 0.0f) {
+      throw std::runtime_error(
+          "DistributedTrainer: workers built networks of different sizes");
+    }
+    // ...and they all start from rank 0's weights
+    broadcastParameters();
+  } catch (...) {
+    if (left_fd >= 0) ::close(left_fd);
+    if (right_fd >= 0) ::close(right_fd);
+    throw;
+  }
+
+  comm = std::thread(&DistributedTrainer::commLoop, this);
+}
+
+DistributedTrainer::~DistributedTrainer() {
+  if (comm.joinable()) {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      stopping = true;
+    }
+    wake.notify_all();
+    comm.join();
+  }
+  if (left_fd >= 0) ::close(left_fd);
+  if (right_fd >= 0) ::close(right_fd);
+}
+
+void DistributedTrainer::rendezvous() {
+  auto deadline = Clock::now() + std::chrono::milliseconds(config.timeout_ms);
+  int world = config.world_size;
+  int next = (config.rank + 1) % world;
+
+  // 1. Listen for our left neighbour on any free port
+  SocketGuard ring_listener(listenOn(0));
+  std::vector<Endpoint> ring(world);
+
+  if (config.rank == 0) {
+    // 2. Rank 0 collects everyone's endpoint, then sends back the table
+    SocketGuard master(listenOn(config.master_port));
+    std::vector<SocketGuard> workers;
+    ring[0] = {0, portOf(ring_listener.fd)};
+    for (int i = 1; i < world; ++i) {
+      sockaddr_in peer{};
+      workers.emplace_back(acceptWithin(master.fd, deadline, &peer));
+      int fd = workers.back().fd;
+      Hello hello{};
+      recvAll(fd, &hello, sizeof(hello));
+      if (hello.rank <= 0 || hello.rank >= world || ring[hello.rank].port) {
+        errno = EPROTO;
+        fail("bad or duplicate rank " + std::to_string(hello.rank));
+      }
+      ring[hello.rank] = {peer.sin_addr.s_addr, hello.ring_port};
+    }
+    for (const SocketGuard& worker : workers) {
+      sendAll(worker.fd, ring.data(), ring.size() * sizeof(Endpoint));
+    }
+  } else {
+    sockaddr_in master = resolve(config.master_addr, config.master_port);
+    SocketGuard conn(connectTo(master, deadline));
+    Hello hello{config.rank, portOf(ring_listener.fd)};
+    sendAll(conn.fd, &hello, sizeof(hello));
+    recvAll(conn.fd, ring.data(), ring.size() * sizeof(Endpoint));
+    ring[0].ip = master.sin_addr.s_addr;
+  }
+
+  // 3. Close the ring: connect to the right, accept from the left
+  sockaddr_in right{};
+  right.sin_family = AF_INET;
+  right.sin_addr.s_addr = ring[next].ip;
+  right.sin_port = htons(static_cast<uint16_t>(ring[next].port));
+  right_fd = connectTo(right, deadline);
+  left_fd = acceptWithin(ring_listener.fd, deadline, nullptr);
+
+  // Small messages (losses, hashes) must not wait for Nagle
+  int on = 1;
+  for (int fd : {left_fd, right_fd}) {
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+  }
+}
+
+void DistributedTrainer::exchange(const void* send, size_t send_bytes,
+                                  void* recv, size_t recv_bytes) {
+  auto* out = static_cast<const char*>(send);
+  auto* in = static_cast<char*>(recv);
+
+  // Both directions at once: every worker sends before it receives, so
+  // blocking sends would deadlock once a chunk outgrows the socket buffers
+  while (send_bytes > 0 || recv_bytes > 0) {
+    pollfd fds[2];
+    int count = 0;
+    if (send_bytes > 0) fds[count++] = {right_fd, POLLOUT, 0};
+    if (recv_bytes > 0) fds[count++] = {left_fd, POLLIN, 0};
+    if (::poll(fds, count, -1) < 0) {
+      if (errno == EINTR) continue;
+      fail("poll");
+    }
+
+    for (int i = 0; i < count; ++i) {
+      if (fds[i].revents == 0) continue;
+      bool sending = fds[i].fd == right_fd && send_bytes > 0;
+      ssize_t n = sending ? ::send(right_fd, out, send_bytes, MSG_NOSIGNAL)
+                          : ::recv(left_fd, in, recv_bytes, 0);
+      if (n < 0 &&
+          (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+        continue;
+      }
+      if (n == 0 && !sending) errno = ECONNRESET;
+      if (n <= 0) fail(sending ? "send to next worker" : "recv from previous");
+      if (sending) {
+        out += n;
+        send_bytes -= n;
+      } else {
+        in += n;
+        recv_bytes -= n;
+      }
+    }
+  }
+}
+
+void DistributedTrainer::allReduce(float* data, size_t n) {
+  int world = config.world_size;
+  if (world < 2 || n == 0) return;
+
+  // Chunk c of W: [n*c/W, n*(c+1)/W), indices taken mod W
+  auto chunk = [&](int c) {
+    c = ((c % world) + world) % world;
+    return std::pair<size_t, size_t>{n * c / world, n * (c + 1) / world};
+  };
+  scratch.resize(n / world + 1);
+  const auto& k = core::kernels::active();
+  int rank = config.rank;
+
+  // 1. Reduce-scatter: after W-1 steps chunk rank+1 holds the full sum
+  for (int s = 0; s < world - 1; ++s) {
+    auto [send_lo, send_hi] = chunk(rank - s);
+    auto [recv_lo, recv_hi] = chunk(rank - s - 1);
+    exchange(data + send_lo, (send_hi - send_lo) * sizeof(float),
+             scratch.data(), (recv_hi - recv_lo) * sizeof(float));
+    k.add(data + recv_lo, scratch.data(), recv_hi - recv_lo);
+  }
+
+  // 2. All-gather: pass the finished chunks around. Each sum is computed
+  // once and copied, so every worker ends with bit-identical results.
+  for (int s = 0; s < world - 1; ++s) {
+    auto [send_lo, send_hi] = chunk(rank + 1 - s);
+    auto [recv_lo, recv_hi] = chunk(rank - s);
+    exchange(data + send_lo, (send_hi - send_lo) * sizeof(float),
+             data + recv_lo, (recv_hi - recv_lo) * sizeof(float));
+  }
+}
+
+float DistributedTrainer::train(const core::ConstMatrixView& input,
+                                const core::ConstMatrixView& target) {
+  if (config.world_size == 1) return network.train(input, target);
+
+  // 1. Backward pass; each layer's gradients start travelling as soon as
+  // they are final
+  float loss = network.computeGradients(input, target, [&](size_t layer) {
+    if (network.layers[layer]->getParameterGradients().empty()) return;
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      pending.push_back(layer);
+    }
+    wake.notify_one();
+  });
+  waitForComm();
+
+  // 2. Same averaged gradients everywhere, so the same step everywhere
+  network.applyGradients();
+
+  allReduce(&loss, 1);
+  loss /= static_cast<float>(config.world_size);
+
+  ++steps;
+  if (config.verify_every > 0 && steps % config.verify_every == 0 &&
+      !parametersInSync()) {
+    throw std::runtime_error(
+        "DistributedTrainer: parameters diverged across workers by step " +
+        std::to_string(steps));
+  }
+  return loss;
+}
+
+bool DistributedTrainer::parametersInSync() {
+  if (config.world_size == 1) return true;
+
+  // Equal to our left neighbour everywhere around the ring = all equal
+  uint64_t mine = hashParameters(network), left = 0;
+  exchange(&mine, sizeof(mine), &left, sizeof(left));
+  float diverged = mine != left ? 1.0f : 0.0f;
+  allReduce(&diverged, 1);
+  return diverged == 0.0f;
+}
+
+void DistributedTrainer::broadcastParameters() {
+  if (config.world_size == 1) return;
+
+  // The whole arena, pipelined along the ring: 0 -> 1 -> ... -> W-1
+  float* params = network.parameterData();
+  size_t bytes = network.getTotalParameters() * sizeof(float);
+  if (config.rank != 0) exchange(nullptr, 0, params, bytes);
+  if (config.rank + 1 < config.world_size) exchange(params, bytes, nullptr, 0);
+}
+
+void DistributedTrainer::commLoop() {
+  std::unique_lock<std::mutex> guard(lock);
+  while (true) {
+    wake.wait(guard, [&] { return stopping || !pending.empty(); });
+    if (pending.empty()) return;
+
+    size_t layer = pending.front();
+    pending.pop_front();
+    busy = true;
+    bool failed = comm_error != nullptr;
+    guard.unlock();
+
+    // After a failure the ring is broken: just drain the queue
+    std::exception_ptr error;
+    if (!failed) {
+      try {
+        reduceLayer(layer);
+      } catch (...) {
+        error = std::current_exception();
+      }
+    }
+
+    guard.lock();
+    if (error) comm_error = error;
+    busy = false;
+    if (pending.empty()) idle.notify_all();
+  }
+}
+
+void DistributedTrainer::reduceLayer(size_t layer) {
+  // A layer's gradients sit back to back in the network's gradient arena
+  auto grads = network.layers[layer]->getParameterGradients();
+  size_t count = 0;
+  for (core::Matrix* g : grads) count += g->size();
+  float* data = grads.front()->rawData();
+
+  allReduce(data, count);
+
+  // Sum -> mean over workers
+  const auto& k = core::kernels::active();
+  k.scale(data, 1.0f / static_cast<float>(config.world_size), count);
+}
+
+void DistributedTrainer::waitForComm() {
+  std::unique_lock<std::mutex> guard(lock);
+  idle.wait(guard, [&] { return pending.empty() && !busy; });
+  if (comm_error) std::rethrow_exception(comm_error);
+}
+
+}  // namespace nn
+}  // namespace talawa
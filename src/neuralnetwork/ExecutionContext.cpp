@@ -0,0 +1,38 @@
+#include "talawa/neuralnetwork/ExecutionContext.hpp"
+
+namespace talawa {
+namespace nn {
+
+ExecutionContext::Entry& ExecutionContext::find(const void* owner, int slot) {
+  for (auto& entry : entries) {
+    if (entry.owner == owner && entry.slot == slot) return entry;
+  }
+  entries.push_back(Entry{owner, slot, {}});
+  return entries.back();
+}
+
+core::MatrixView ExecutionContext::buffer(const void* owner, int slot,
+                                          size_t rows, size_t cols) {
+  auto& storage = find(owner, slot).storage;
+  if (storage.size() < rows * cols) storage.resizeForOverwrite(rows * cols);
+  return core::MatrixView(storage.data(), rows, cols);
+}
+
+void ExecutionContext::reserve(const void* owner, int slot, size_t count) {
+  auto& storage = find(owner, slot).storage;
+  if (storage.size() < count) storage.resizeForOverwrite(count);
+}
+
+void ExecutionContext::bind(const void* owner, int slot, float* data,
+                            size_t count) {
+  find(owner, slot).storage.borrow(data, count);
+}
+
+size_t ExecutionContext::capacity() const {
+  size_t total = 0;
+  for (const auto& entry : entries) total += entry.storage.size();
+  return total;
+}
+
+}  // namespace nn
+}  // namespace talawa
@@ -0,0 +1,196 @@
+#include "talawa/neuralnetwork/InferencePlan.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#include "talawa/neuralnetwork/Conv2DLayer.hpp"
+#include "talawa/neuralnetwork/DenseLayer.hpp"
+#include "talawa/neuralnetwork/DepthwiseConv2DLayer.hpp"
+#include "talawa/neuralnetwork/Pooling2DLayer.hpp"
+
+namespace talawa {
+namespace nn {
+
+using namespace core;
+
+namespace {
+gemm::Operand asOperand(const ConstMatrixView& m) {
+  return {m.rawData(), static_cast<std::ptrdiff_t>(m.stride), 1};
+}
+
+gemm::PackedB pack(const Matrix& weights) {
+  return gemm::PackedB(weights.rows, weights.cols, asOperand(weights));
+}
+}  // namespace
+
+InferencePlan::InferencePlan(const std::vector<std::unique_ptr<ILayer>>& layers,
+                             size_t input_size, size_t max_batch)
+    : input_size(input_size),
+      output_size(input_size),
+      max_batch(std::max<size_t>(1, max_batch)) {
+  size_t widest = 0, pixels_size = 0;
+
+  for (const auto& layer : layers) {
+    Step step;
+    step.out_cols = layer->getOutputShape().flat();
+    step.activation = layer->activation;
+
+    if (auto* dense = dynamic_cast<const DenseLayer*>(layer.get())) {
+      step.type = StepType::DENSE;
+      step.weights = pack(dense->weights);
+      step.biases = dense->biases;
+
+    } else if (auto* conv = dynamic_cast<const Conv2DLayer*>(layer.get())) {
+      step.type = StepType::CONV2D;
+      if (conv->winograd_tile > 0) {
+        step.winograd = conv->winogradFilters();
+      } else {
+        step.weights = pack(conv->kernels);
+      }
+      step.biases = conv->biases;
+
+      // Keep the geometry only: weights are packed above, caches unused
+      auto geometry = std::make_unique<Conv2DLayer>(*conv);
+      geometry->kernels = Matrix();
+      geometry->biases = Matrix();
+      geometry->input_cache = Matrix();
+      geometry->kernels_grad = Matrix();
+      geometry->biases_grad = Matrix();
+      step.layer = std::move(geometry);
+
+      size_t pixels =
+          this->max_batch * conv->output_height * conv->output_width;
+      if (conv->layout == Layout::NCHW) {
+        pixels_size = std::max(pixels_size, pixels * conv->filters);
+      }
+
+    } else if (auto* dw =
+                   dynamic_cast<const DepthwiseConv2DLayer*>(layer.get())) {
+      step.type = StepType::DEPTHWISE2D;
+      auto copy = std::make_unique<DepthwiseConv2DLayer>(*dw);
+      copy->input_cache = Matrix();
+      copy->kernels_grad = Matrix();
+      copy->biases_grad = Matrix();
+      step.layer = std::move(copy);
+
+    } else if (auto* pool = dynamic_cast<const Pooling2DLayer*>(layer.get())) {
+      step.type = StepType::POOL2D;
+      auto geometry = std::make_unique<Pooling2DLayer>(*pool);
+      geometry->max_indices = {};
+      step.layer = std::move(geometry);
+
+    } else {
+      // Layers injected through the builder run their own forward pass
+      step.type = StepType::LAYER;
+      step.layer = layer->clone();
+    }
+
+    widest = std::max(widest, step.out_cols);
+    output_size = step.out_cols;
+    steps.push_back(std::move(step));
+  }
+
+  // Every buffer predict() will ever need, sized for max_batch
+  slot_sizes[PING] = slot_sizes[PONG] = this->max_batch * widest;
+  slot_sizes[PIXELS] = pixels_size;
+  own_context = createContext();
+}
+
+ExecutionContext InferencePlan::createContext() const {
+  ExecutionContext ctx;
+  for (int slot : {PING, PONG, PIXELS}) {
+    if (slot_sizes[slot] > 0) ctx.reserve(steps.data(), slot, slot_sizes[slot]);
+  }
+  return ctx;
+}
+
+ConstMatrixView InferencePlan::predict(const ConstMatrixView& input) {
+  return predict(input, own_context);
+}
+
+ConstMatrixView InferencePlan::predict(const ConstMatrixView& input,
+                                       ExecutionContext& ctx) const {
+  if (input.cols != input_size || input.rows > max_batch) {
+    THROW_talawa_ERROR(InferencePlan,
+                       "Input (" << input.rows << "x" << input.cols
+                                 << ") does not fit a plan compiled for up to ("
+                                 << max_batch << "x" << input_size << ")");
+  }
+  size_t batch = input.rows;
+
+  // The first step reads the caller's rows in place
+  ConstMatrixView current = input;
+  Slot next = PING;
+  for (const Step& step : steps) {
+    MatrixView out = ctx.buffer(steps.data(), next, batch, step.out_cols);
+
+    switch (step.type) {
+      case StepType::DENSE:
+        // A = f(X . W + b), bias and activation fused into the GEMM
+        gemm::sgemm(batch, asOperand(current), step.weights, out.rawData(),
+                    out.stride, false,
+                    step.activation.epilogue(step.biases.rawData()));
+        if (!step.activation.isElementwise()) step.activation.applyInPlace(out);
+        break;
+
+      case StepType::CONV2D: {
+        const auto& conv = static_cast<const Conv2DLayer&>(*step.layer);
+        size_t pixels = batch * conv.output_height * conv.output_width;
+        bool nhwc = conv.layout == Layout::NHWC;
+        // NHWC: the GEMM writes the step's output directly
+        MatrixView pixel_major =
+            nhwc ? MatrixView(out.rawData(), pixels, conv.filters)
+                 : ctx.buffer(steps.data(), PIXELS, pixels, conv.filters);
+
+        // 1. Implicit GEMM (or Winograd) + bias + activation, pixel-major
+        auto epilogue = step.activation.epilogue(step.biases.rawData());
+        if (conv.pointwise()) {
+          conv.pointwiseRuns(current, [&](int rows, gemm::Operand image,
+                                          size_t first) {
+            gemm::sgemm(rows, image, step.weights, pixel_major.row(first),
+                        pixel_major.stride, false, epilogue);
+          });
+        } else if (step.winograd) {
+          winograd::conv3x3(conv.inputImage(current), conv.padding,
+                            *step.winograd, pixel_major.rawData(),
+                            pixel_major.stride, epilogue);
+        } else {
+          gemm::sgemm(pixels,
+                      gemm::gather(Conv2DLayer::Patches{conv, current}),
+                      step.weights, pixel_major.rawData(), pixel_major.stride,
+                      false, epilogue);
+        }
+        if (!step.activation.isElementwise()) {
+          step.activation.applyInPlace(pixel_major);
+        }
+        // 2. Back to (Batch, F*OH*OW)
+        if (!nhwc) conv.toImageMajor(pixel_major, out);
+        break;
+      }
+
+      case StepType::DEPTHWISE2D:
+        // Straight into the step's output, bias and activation included
+        static_cast<const DepthwiseConv2DLayer&>(*step.layer)
+            .convolve(current, out);
+        break;
+
+      case StepType::POOL2D:
+        static_cast<const Pooling2DLayer&>(*step.layer).pool(current, out,
+                                                             nullptr);
+        break;
+
+      case StepType::LAYER:
+        // Layers without a plan step use their own reentrant path
+        out.copyFrom(step.layer->infer(current, ctx));
+        break;
+    }
+
+    current = out;
+    next = next == PING ? PONG : PING;
+  }
+  return current;
+}
+
+}  // namespace nn
+}  // namespace talawa
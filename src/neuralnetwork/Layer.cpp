@@ -0,0 +1,40 @@
+#include "talawa/neuralnetwork/Layer.hpp"
+
+#include <mutex>
+
+namespace talawa {
+namespace nn {
+
+ConstMatrixView ILayer::infer(const ConstMatrixView& input,
+                              ExecutionContext& ctx) const {
+  // forward() may write layer state, so only one such call runs at a time
+  static std::mutex forward_mutex;
+  Matrix output;
+  {
+    std::lock_guard<std::mutex> lock(forward_mutex);
+    output = const_cast<ILayer*>(this)->forward(input, false);
+  }
+
+  MatrixView result = ctx.buffer(this, 0, output.rows, output.cols);
+  result.copyFrom(output);
+  return result;
+}
+
+ConstMatrixView ILayer::trainForward(const ConstMatrixView& input,
+                                     ExecutionContext& ctx) {
+  Matrix output = forward(input, true);
+  MatrixView result = ctx.buffer(this, 0, output.rows, output.cols);
+  result.copyFrom(output);
+  return result;
+}
+
+ConstMatrixView ILayer::trainBackward(const ConstMatrixView& outputGradients,
+                                      ExecutionContext& ctx) {
+  Matrix gradient = backward(Matrix(outputGradients));
+  MatrixView result = ctx.buffer(this, 1, gradient.rows, gradient.cols);
+  result.copyFrom(gradient);
+  return result;
+}
+
+}  // namespace nn
+}  // namespace talawa
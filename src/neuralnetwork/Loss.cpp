@@ -1,12 +1,11 @@
 #include "talawa/neuralnetwork/Loss.hpp"
 
-#include <immintrin.h>
-#include <omp.h>
-
 #include <algorithm>
 #include <cmath>
 #include <iostream>
 
+#include "talawa/core/Parallel.hpp"
+
 namespace talawa {
 namespace nn {
 namespace loss {
@@ -21,7 +20,7 @@ const float EPSILON = 1e-7f;
 // ==========================================
 
 float MeanSquaredError::calculate(const Matrix& prediction,
-                                  const Matrix& target) {
+                                  const ConstMatrixView& target) {
   float total_loss = prediction.reduce<float>(
       [&](float acc, int row, int col, float pred_val) {
         float true_val = target(row, col);
@@ -35,7 +34,7 @@ float MeanSquaredError::calculate(const Matrix& prediction,
 }
 
 Matrix MeanSquaredError::gradient(const Matrix& prediction,
-                                  const Matrix& target) {
+                                  const ConstMatrixView& target) {
   // Gradient: dL/dY = (2/N) * (y_pred - y_true)
 
   float n = static_cast<float>(prediction.rows * prediction.cols);
@@ -53,7 +52,7 @@ Matrix MeanSquaredError::gradient(const Matrix& prediction,
 // ==========================================
 
 float CrossEntropyLoss::calculate(const Matrix& prediction,
-                                  const Matrix& target) {
+                                  const ConstMatrixView& target) {
   float total_loss = prediction.reduce<float>(
       [&](float acc, int row, int col, float pred_val) {
         float true_val = target(row, col);
@@ -65,7 +64,7 @@ float CrossEntropyLoss::calculate(const Matrix& prediction,
 }
 
 Matrix CrossEntropyLoss::gradient(const Matrix& prediction,
-                                  const Matrix& target) {
+                                  const ConstMatrixView& target) {
   // Gradient: dL/dY = - (y_true / y_pred) / N
   float n = static_cast<float>(prediction.rows);
   return prediction.map([&](int row, int col, float pred_val) {
@@ -80,7 +79,7 @@ Matrix CrossEntropyLoss::gradient(const Matrix& prediction,
 // ==========================================
 
 float CategoricalCrossEntropyLoss::calculate(const Matrix& prediction,
-                                             const Matrix& target) {
+                                             const ConstMatrixView& target) {
   float total_loss = prediction.reduce<float>(
       [&target](float acc, int row, int col, float value) {
         float p = std::clamp(value, EPSILON, 1.0f - EPSILON);
@@ -93,7 +92,7 @@ float CategoricalCrossEntropyLoss::calculate(const Matrix& prediction,
 }
 
 Matrix CategoricalCrossEntropyLoss::gradient(const Matrix& prediction,
-                                             const Matrix& target) {
+                                             const ConstMatrixView& target) {
   // Gradient w.r.t Prediction: dL/dp = - (target / prediction)
   float batch_scale = 1.0f / static_cast<float>(prediction.rows);
 
@@ -111,7 +110,7 @@ Matrix CategoricalCrossEntropyLoss::gradient(const Matrix& prediction,
 // Cross Entropy With Logits (Stable)
 // ==========================================
 float CrossEntropyWithLogitsLoss::calculate(const Matrix& prediction,
-                                            const Matrix& target) {
+                                            const ConstMatrixView& target) {
   // Prediction contains LOGITS (Raw Z).
   // Formula: - sum( target * log_softmax(z) )
   float total_loss = 0.0f;
@@ -145,7 +144,7 @@ float CrossEntropyWithLogitsLoss::calculate(const Matrix& prediction,
 }
 
 Matrix CrossEntropyWithLogitsLoss::gradient(const Matrix& prediction,
-                                            const Matrix& target) {
+                                            const ConstMatrixView& target) {
   // dL/dZ = Softmax(Z) - Target
   // This is ALWAYS bounded between -1 and 1. No explosions.
 
@@ -156,38 +155,41 @@ Matrix CrossEntropyWithLogitsLoss::gradient(const Matrix& prediction,
 
   float* G = grad.rawData();
   const float* P = prediction.rawData();
-  const float* T = target.rawData();
-
-#pragma omp parallel for
-  for (int r = 0; r < n_rows; ++r) {
-    const float* pred_row = &P[r * n_cols];
-    const float* targ_row = &T[r * n_cols];
-    float* grad_row = &G[r * n_cols];
-
-    // 1. Softmax Calculation
-    float max_val = pred_row[0];
-    for (int c = 1; c < n_cols; ++c) {
-      if (pred_row[c] > max_val) max_val = pred_row[c];
-    }
 
-    float sum_exp = 0.0f;
-    for (int c = 0; c < n_cols; ++c) {
-      sum_exp += std::exp(pred_row[c] - max_val);
-    }
+  // Small batches (e.g. DQN updates) are not worth waking other threads
+  int row_grain = std::max(1, (1 << 14) / std::max(1, n_cols));
+  parallel::parallelFor(0, n_rows, row_grain, [&](auto first, auto last) {
+    for (int r = first; r < last; ++r) {
+      const float* pred_row = &P[r * n_cols];
+      const float* targ_row = target.row(r);
+      float* grad_row = &G[r * n_cols];
+
+      // 1. Softmax Calculation
+      float max_val = pred_row[0];
+      for (int c = 1; c < n_cols; ++c) {
+        if (pred_row[c] > max_val) max_val = pred_row[c];
+      }
 
-    // 2. Gradient Calculation
-    float inv_sum = 1.0f / sum_exp;
-    for (int c = 0; c < n_cols; ++c) {
-      float softmax_p = std::exp(pred_row[c] - max_val) * inv_sum;
-      float t = targ_row[c];
-      // Result = (P - T) / BatchSize
-      grad_row[c] = (softmax_p - t) * batch_scale;
+      float sum_exp = 0.0f;
+      for (int c = 0; c < n_cols; ++c) {
+        sum_exp += std::exp(pred_row[c] - max_val);
+      }
+
+      // 2. Gradient Calculation
+      float inv_sum = 1.0f / sum_exp;
+      for (int c = 0; c < n_cols; ++c) {
+        float softmax_p = std::exp(pred_row[c] - max_val) * inv_sum;
+        float t = targ_row[c];
+        // Result = (P - T) / BatchSize
+        grad_row[c] = (softmax_p - t) * batch_scale;
+      }
     }
-  }
+  });
   return grad;
 }
 
-float HuberLoss::calculate(const Matrix& prediction, const Matrix& target) {
+float HuberLoss::calculate(const Matrix& prediction,
+                           const ConstMatrixView& target) {
   float total_loss = prediction.reduce<float>(
       [&](float acc, int row, int col, float pred_val) {
         float true_val = target(row, col);
@@ -201,7 +203,8 @@ float HuberLoss::calculate(const Matrix& prediction, const Matrix& target) {
   return total_loss / static_cast<float>(prediction.rows * prediction.cols);
 }
 
-Matrix HuberLoss::gradient(const Matrix& prediction, const Matrix& target) {
+Matrix HuberLoss::gradient(const Matrix& prediction,
+                           const ConstMatrixView& target) {
   // Gradient:
   //   error              if |error| <= delta
   //   delta * sign(error)  otherwise
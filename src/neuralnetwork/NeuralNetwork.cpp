@@ -9,37 +9,57 @@
 #include "talawa/core/Optimizer.hpp"
 #include "talawa/neuralnetwork/Conv2DLayer.hpp"
 #include "talawa/neuralnetwork/DenseLayer.hpp"
+#include "talawa/neuralnetwork/DepthwiseConv2DLayer.hpp"
 
 namespace talawa::nn {
 class LayerFactory {
  public:
   static std::pair<std::unique_ptr<ILayer>, Shape> create(
-      const Conv2DLayerConfig& cfg, const Shape& input_shape) {
+      const Conv2DLayerConfig& cfg, const Shape& input_shape, Layout layout) {
     auto layer = std::make_unique<Conv2DLayer>(
         input_shape.depth, input_shape.height, input_shape.width, cfg.filters,
-        cfg.kernel_size, cfg.stride, cfg.padding, cfg.init, cfg.act);
+        cfg.kernel_size, cfg.stride, cfg.padding, cfg.init, cfg.act, layout,
+        cfg.algorithm);
     Shape next = layer->getOutputShape();
     std::cout << "Created Conv2DLayer: " << layer->info() << "\n";
     return {std::move(layer), next};
   }
 
   static std::pair<std::unique_ptr<ILayer>, Shape> create(
-      const DenseLayerConfig& cfg, const Shape& input_shape) {
+      const DepthwiseConv2DLayerConfig& cfg, const Shape& input_shape,
+      Layout layout) {
+    auto layer = std::make_unique<DepthwiseConv2DLayer>(
+        input_shape.depth, input_shape.height, input_shape.width,
+        cfg.kernel_size, cfg.stride, cfg.padding, cfg.init, cfg.act, layout);
+    Shape next = layer->getOutputShape();
+    std::cout << "Created DepthwiseConv2DLayer: " << layer->info() << "\n";
+    return {std::move(layer), next};
+  }
+
+  static std::pair<std::unique_ptr<ILayer>, Shape> create(
+      const DenseLayerConfig& cfg, const Shape& input_shape, Layout) {
     auto layer = std::make_unique<DenseLayer>(input_shape.flat(), cfg.neurons,
                                               cfg.act, cfg.init);
     Shape next = layer->getOutputShape();
     return {std::move(layer), next};
   }
   static std::pair<std::unique_ptr<ILayer>, Shape> create(
-      const Pooling2DLayerConfig& cfg, const Shape& input_shape) {
+      const Pooling2DLayerConfig& cfg, const Shape& input_shape,
+      Layout layout) {
     auto layer = std::make_unique<Pooling2DLayer>(
         input_shape.depth, input_shape.height, input_shape.width, cfg.type,
-        cfg.pool_size, cfg.stride);
+        cfg.pool_size, cfg.stride, layout);
     Shape next = layer->getOutputShape();
     return {std::move(layer), next};
   }
 };
 
+namespace {
+const char* layoutName(Layout layout) {
+  return layout == Layout::NHWC ? "NHWC" : "NCHW";
+}
+}  // namespace
+
 NeuralNetworkBuilder NeuralNetworkBuilder::create(const Shape& shape) {
   NeuralNetworkBuilder builder;
   builder.input_shape = shape;
@@ -60,6 +80,15 @@ NeuralNetworkBuilder& NeuralNetworkBuilder::setLossFunction(
   loss_fn = std::move(loss);
   return *this;
 }
+NeuralNetworkBuilder& NeuralNetworkBuilder::setLayout(Layout layout) {
+  this->layout = layout;
+  return *this;
+}
+NeuralNetworkBuilder& NeuralNetworkBuilder::setCheckpointing(
+    size_t segment_layers) {
+  checkpoint_segment = segment_layers;
+  return *this;
+}
 std::unique_ptr<NeuralNetwork> NeuralNetworkBuilder::build(
     float learning_rate) {
   prebuild();
@@ -75,13 +104,14 @@ std::unique_ptr<NeuralNetwork> NeuralNetworkBuilder::build(
   network->optimizer = std::move(optimizer);
   network->loss_fn = std::move(loss_fn);
   network->input_shape = this->input_shape;
+  network->checkpoint_segment = checkpoint_segment;
   for (auto& layer : prebuilt_layers) {
     network->layers.push_back(std::move(layer));
   }
   prebuilt_layers.clear();
 
-  // Recompute total parameters after all layers are created
-  network->recalcTotalParameters();
+  // One contiguous arena for all parameters (and one for gradients)
+  network->bindParameters();
 
   network->set_learning_rate(learning_rate);  // Propagate learning rate
   return network;
@@ -95,7 +125,7 @@ void NeuralNetworkBuilder::prebuild() {
     const auto& config_variant = configs[i];
     std::visit(
         [&](auto&& config) {
-          auto result = LayerFactory::create(config, current_shape);
+          auto result = LayerFactory::create(config, current_shape, layout);
           prebuilt_layers.push_back(std::move(result.first));
           current_shape = result.second;
         },
@@ -115,46 +145,114 @@ NeuralNetworkBuilder& NeuralNetworkBuilder::inject(
   return *this;
 }
 
-core::Matrix NeuralNetwork::predict(const core::Matrix& input) const {
-  auto output = input;
+core::Matrix NeuralNetwork::predict(const core::ConstMatrixView& input) const {
+  ExecutionContext ctx;
+  return core::Matrix(predict(input, ctx));
+}
 
-  for (const auto& layer : layers) {
-    output = layer->forward(output, false);
-  }
+core::ConstMatrixView NeuralNetwork::predict(const core::ConstMatrixView& input,
+                                             ExecutionContext& ctx) const {
+  // The first layer reads the caller's rows in place (no input copy)
+  core::ConstMatrixView output = input;
+  for (const auto& layer : layers) output = layer->infer(output, ctx);
   return output;
 }
-float NeuralNetwork::train(const core::Matrix& input,
-                           const core::Matrix& target) {
-  // 1. Forward Pass (Record operations for Backprop)
-  auto output = input;
-  for (auto& layer : layers) {
-    output = layer->forward(output, true);
+
+InferencePlan NeuralNetwork::compileForInference(size_t max_batch) const {
+  return InferencePlan(layers, input_shape.flat(), max_batch);
+}
+
+float NeuralNetwork::train(const core::ConstMatrixView& input,
+                           const core::ConstMatrixView& target) {
+  if (per_layer_updates && optimizer->canSplitSteps()) {
+    // Each layer is done with its weights once its backward returns, so
+    // they can be stepped while the gradients are still hot
+    optimizer->beginStep(param_list, grad_list);
+    return computeGradients(input, target, [&](size_t i) {
+      optimizer->updateTensors(param_list, grad_list, layer_tensors[i],
+                               layer_tensors[i + 1]);
+    });
   }
 
-  // 2. Calculate Loss & Gradient
-  float loss_val = loss_fn->calculate(output, target);
-  core::Matrix error = loss_fn->gradient(output, target);  // dL/dY
+  float loss_val = computeGradients(input, target);
+  applyGradients();
+  return loss_val;
+}
 
-  // 3. Backward Pass
-  core::Matrix gradient = error;
-  for (auto it = layers.rbegin(); it != layers.rend(); ++it) {
-    gradient = (*it)->backward(gradient);
+float NeuralNetwork::computeGradients(
+    const core::ConstMatrixView& input, const core::ConstMatrixView& target,
+    const std::function<void(size_t)>& after_backward) {
+  if (!training_plan || input.rows > training_plan->batch()) {
+    planTraining(input.rows);
   }
+  ExecutionContext& ctx = training_plan->context();
+  const auto& schedule = training_plan->schedule();
+
+  // Layer outputs as of their latest forward; the first layer reads the
+  // caller's rows in place
+  std::vector<core::ConstMatrixView> outputs(layers.size());
+  auto runForward = [&](size_t i) {
+    core::ConstMatrixView layer_input = i == 0 ? input : outputs[i - 1];
+    outputs[i] = layers[i]->trainForward(layer_input, ctx);
+  };
+
+  // 1. Forward Pass: every layer keeps views of its input and output for
+  // backprop, all in the plan's arena
+  size_t step = 0;
+  for (; step < layers.size(); ++step) runForward(schedule[step].layer);
 
-  // 4. Update Weights
-  std::vector<core::Matrix*> all_params;
-  std::vector<core::Matrix*> all_grads;
+  // 2. Calculate Loss & Gradient
+  core::Matrix prediction(layers.empty() ? input : outputs.back());
+  float loss_val = loss_fn->calculate(prediction, target);
+  core::Matrix error = loss_fn->gradient(prediction, target);  // dL/dY
+
+  // 3. Backward Pass, segment by segment when checkpointing: a segment's
+  // activations are recomputed from its checkpoint right before its
+  // backward
+  core::ConstMatrixView gradient = error;
+  for (; step < schedule.size(); ++step) {
+    size_t i = schedule[step].layer;
+    if (schedule[step].forward) {
+      runForward(i);
+      continue;
+    }
+    gradient = layers[i]->trainBackward(gradient, ctx);
+    if (after_backward) after_backward(i);
+  }
+  return loss_val;
+}
 
+void NeuralNetwork::planTraining(size_t max_batch) {
+  training_plan =
+      std::make_unique<ActivationPlan>(layers, max_batch, checkpoint_segment);
+}
+
+void NeuralNetwork::setCheckpointing(size_t segment_layers) {
+  checkpoint_segment = segment_layers;
+  training_plan.reset();  // Replanned by the next step
+}
+
+void NeuralNetwork::applyGradients() {
+  // 4. Update Weights: the tensors tile the arena, so this is one sweep
+  optimizer->update(param_list, grad_list);
+}
+
+std::vector<core::Matrix*> NeuralNetwork::parameters() {
+  std::vector<core::Matrix*> all_params;
   for (auto& layer : layers) {
     auto p = layer->getParameters();
-    auto g = layer->getParameterGradients();
     all_params.insert(all_params.end(), p.begin(), p.end());
-    all_grads.insert(all_grads.end(), g.begin(), g.end());
   }
+  return all_params;
+}
 
-  optimizer->update(all_params, all_grads);
-
-  return loss_val;
+std::vector<core::Matrix*> NeuralNetwork::gradients() {
+  std::vector<core::Matrix*> all_grads;
+  for (auto& layer : layers) {
+    auto g = layer->getParameterGradients();
+    all_grads.insert(all_grads.end(), g.begin(), g.end());
+  }
+  return all_grads;
 }
 
 Shape NeuralNetwork::get_input_shape() const { return input_shape; }
@@ -171,15 +269,18 @@ bool NeuralNetwork::save(std::ostream& out) const {
   size_t layer_count = layers.size();
   out.write(reinterpret_cast<const char*>(&layer_count), sizeof(size_t));
 
-  // Save each layer (first write an int identifying type)
+  // Save each layer (first write an int identifying type). Channels-last
+  // layers get types of their own, so older files still load as NCHW.
   for (const auto& layer : layers) {
     int layer_type = -1;
     if (dynamic_cast<DenseLayer*>(layer.get())) {
       layer_type = 0;
-    } else if (dynamic_cast<Conv2DLayer*>(layer.get())) {
-      layer_type = 1;
-    } else if (dynamic_cast<Pooling2DLayer*>(layer.get())) {
-      layer_type = 2;
+    } else if (auto* conv = dynamic_cast<Conv2DLayer*>(layer.get())) {
+      layer_type = conv->getLayout() == Layout::NHWC ? 3 : 1;
+    } else if (auto* pool = dynamic_cast<Pooling2DLayer*>(layer.get())) {
+      layer_type = pool->getLayout() == Layout::NHWC ? 4 : 2;
+    } else if (auto* dw = dynamic_cast<DepthwiseConv2DLayer*>(layer.get())) {
+      layer_type = dw->getLayout() == Layout::NHWC ? 6 : 5;
     } else {
       throw std::runtime_error("Unknown layer type during saving.");
     }
@@ -222,9 +323,18 @@ bool NeuralNetwork::saveToFile(const std::string& filename) const {
       type = "Conv2D";
     else if (dynamic_cast<Pooling2DLayer*>(layer.get()))
       type = "Pooling2D";
+    else if (dynamic_cast<DepthwiseConv2DLayer*>(layer.get()))
+      type = "DepthwiseConv2D";
 
     yout << "- type: " << type << "\n";
     yout << "  activation: " << layer->activation.getName() << "\n";
+    if (auto* conv = dynamic_cast<Conv2DLayer*>(layer.get())) {
+      yout << "  layout: " << layoutName(conv->getLayout()) << "\n";
+    } else if (auto* pool = dynamic_cast<Pooling2DLayer*>(layer.get())) {
+      yout << "  layout: " << layoutName(pool->getLayout()) << "\n";
+    } else if (auto* dw = dynamic_cast<DepthwiseConv2DLayer*>(layer.get())) {
+      yout << "  layout: " << layoutName(dw->getLayout()) << "\n";
+    }
 
     auto params = layer->getParameters();
     if (!params.empty()) {
@@ -278,6 +388,14 @@ std::unique_ptr<NeuralNetwork> NeuralNetwork::load(std::istream& in) {
       layer = std::make_unique<Conv2DLayer>();
     } else if (layer_type == 2) {  // Pooling2DLayer
       layer = std::make_unique<Pooling2DLayer>();
+    } else if (layer_type == 3) {  // Conv2DLayer, NHWC
+      layer = std::make_unique<Conv2DLayer>(Layout::NHWC);
+    } else if (layer_type == 4) {  // Pooling2DLayer, NHWC
+      layer = std::make_unique<Pooling2DLayer>(Layout::NHWC);
+    } else if (layer_type == 5) {  // DepthwiseConv2DLayer
+      layer = std::make_unique<DepthwiseConv2DLayer>();
+    } else if (layer_type == 6) {  // DepthwiseConv2DLayer, NHWC
+      layer = std::make_unique<DepthwiseConv2DLayer>(Layout::NHWC);
     } else {
       throw std::runtime_error("Unknown layer type during loading.");
     }
@@ -286,21 +404,63 @@ std::unique_ptr<NeuralNetwork> NeuralNetwork::load(std::istream& in) {
     network->layers.push_back(std::move(layer));
   }
 
-  // Recompute parameter count for the newly-loaded network
-  network->recalcTotalParameters();
+  // Move the loaded parameters into the network's arena
+  network->bindParameters();
 
   return network;
 }
 
-// Recompute total parameters helper
-void NeuralNetwork::recalcTotalParameters() {
-  int total = 0;
-  for (const auto& layer : layers) {
-    auto params = layer->getParameters();
-    for (const auto& p : params) {
-      total += static_cast<int>(p->rows) * static_cast<int>(p->cols);
+void NeuralNetwork::bindParameters() {
+  auto params = parameters();
+  auto grads = gradients();
+  size_t total = 0;
+  for (size_t i = 0; i < params.size(); ++i) {
+    if (i >= grads.size() || grads[i]->size() != params[i]->size()) {
+      throw std::runtime_error("Layer gradients do not match its parameters.");
     }
+    total += params[i]->size();
+  }
+
+  // Fresh arenas first: the matrices may still be bound to the old ones
+  core::Matrix new_params(1, static_cast<int>(total));
+  core::Matrix new_grads(1, static_cast<int>(total));
+  size_t offset = 0;
+  for (size_t i = 0; i < params.size(); ++i) {
+    params[i]->bindStorage(new_params.rawData() + offset);
+    grads[i]->bindStorage(new_grads.rawData() + offset);
+    offset += params[i]->size();
   }
-  this->_totalParameters = total;
+  param_arena = std::move(new_params);
+  grad_arena = std::move(new_grads);
+  _totalParameters = static_cast<int>(total);
+
+  param_list = std::move(params);
+  grad_list = std::move(grads);
+  layer_tensors.assign(1, 0);
+  for (auto& layer : layers) {
+    layer_tensors.push_back(layer_tensors.back() +
+                            layer->getParameters().size());
+  }
+}
+
+bool NeuralNetwork::saveParameters(const std::string& filename) const {
+  std::ofstream out(filename, std::ios::binary);
+  if (!out) return false;
+  size_t count = param_arena.size();
+  out.write(reinterpret_cast<const char*>(&count), sizeof(size_t));
+  out.write(reinterpret_cast<const char*>(param_arena.rawData()),
+            count * sizeof(float));
+  return out.good();
+}
+
+bool NeuralNetwork::loadParameters(const std::string& filename) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in) return false;
+  size_t count = 0;
+  in.read(reinterpret_cast<char*>(&count), sizeof(size_t));
+  if (!in || count != param_arena.size()) return false;
+  in.read(reinterpret_cast<char*>(param_arena.rawData()),
+          count * sizeof(float));
+  return in.good();
 }
 }  // namespace talawa::nn
@@ -1,19 +1,28 @@
 #include "talawa/neuralnetwork/Pooling2DLayer.hpp"
 
-#include <omp.h>
-
 #include <algorithm>
 #include <iostream>
 #include <limits>
 #include <sstream>
 
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Parallel.hpp"
+
 namespace talawa {
 namespace nn {
 
 using namespace core;
 
+namespace {
+// Training buffers (see trainingBuffers)
+enum Slot { OUTPUT, INPUT_GRADIENT };
+
+// NHWC units: channels per unit
+constexpr int CHANNEL_BLOCK = 16;
+}  // namespace
+
 // Default constructor for load-time construction
-Pooling2DLayer::Pooling2DLayer()
+Pooling2DLayer::Pooling2DLayer(Layout layout)
     : depth(0),
       input_height(0),
       input_width(0),
@@ -21,16 +30,18 @@ Pooling2DLayer::Pooling2DLayer()
       pool_size(2),
       stride(2),
       output_height(0),
-      output_width(0) {}
+      output_width(0),
+      layout(layout) {}
 
 Pooling2DLayer::Pooling2DLayer(int d, int h, int w, PoolingType type, int ps,
-                               int s)
+                               int s, Layout layout)
     : depth(d),
       input_height(h),
       input_width(w),
       type(type),
       pool_size(ps),
-      stride(s) {
+      stride(s),
+      layout(layout) {
   output_height = (input_height - pool_size) / stride + 1;
   output_width = (input_width - pool_size) / stride + 1;
   this->activation = Activation::LINEAR;
@@ -60,130 +71,175 @@ void Pooling2DLayer::load(std::istream& in_stream) {
   this->activation = Activation::LINEAR;
 }
 
-core::Matrix Pooling2DLayer::forward(const core::Matrix& input,
+core::Matrix Pooling2DLayer::forward(const core::ConstMatrixView& input,
                                      bool is_training) {
-  int batch_size = input.rows;
-  int output_pixels = output_height * output_width;
-  int output_cols = depth * output_pixels;
+  if (is_training) return Matrix(trainForward(input, buffers));
+
+  Matrix output(input.rows, depth * output_height * output_width);
+  pool(input, output, nullptr);
+  return output;
+}
+
+core::Matrix Pooling2DLayer::backward(const core::Matrix& outputGradients) {
+  return Matrix(trainBackward(outputGradients, buffers));
+}
 
-  Matrix output(batch_size, output_cols);
+ConstMatrixView Pooling2DLayer::trainForward(const ConstMatrixView& input,
+                                             ExecutionContext& ctx) {
+  int output_cols = depth * output_height * output_width;
+  MatrixView output = ctx.buffer(this, OUTPUT, input.rows, output_cols);
 
-  if (is_training && type == PoolingType::MAX) {
-    max_indices_cache.assign(batch_size, std::vector<int>(output_cols, -1));
+  // Only grows: steps of the same batch size reuse the buffer
+  int* indices = nullptr;
+  if (type == PoolingType::MAX) {
+    max_indices.resize(input.rows * output_cols);
+    indices = max_indices.data();
   }
+  pool(input, output, indices);
+  return output;
+}
+
+ConstMatrixView Pooling2DLayer::infer(const ConstMatrixView& input,
+                                      ExecutionContext& ctx) const {
+  MatrixView output =
+      ctx.buffer(this, 0, input.rows, depth * output_height * output_width);
+  pool(input, output, nullptr);
+  return output;
+}
+
+std::ptrdiff_t Pooling2DLayer::unitsPerImage() const {
+  if (layout == Layout::NCHW) return depth;
+  return (depth + CHANNEL_BLOCK - 1) / CHANNEL_BLOCK;
+}
+
+Pooling2DLayer::Unit Pooling2DLayer::unit(std::ptrdiff_t index) const {
+  std::ptrdiff_t per_image = unitsPerImage();
+  size_t b = index / per_image;
+  int j = index % per_image;
+  if (layout == Layout::NCHW) {
+    return {b,
+            j * input_height * input_width,
+            j * output_height * output_width,
+            {1, 1, output_width, pool_size, stride}};
+  }
+  int c0 = j * CHANNEL_BLOCK;
+  int channels = std::min(CHANNEL_BLOCK, depth - c0);
+  return {b, c0, c0, {channels, depth, output_width, pool_size, stride}};
+}
 
-  // Pre-calculate scaling factor for Average pooling
-  float avg_scale = 1.0f / (pool_size * pool_size);
+// Every output row starts at the identity (-inf or 0) and takes in the
+// window's input rows one at a time (kernels::pool_max_row/pool_sum_row)
+void Pooling2DLayer::pool(const core::ConstMatrixView& input,
+                          const core::MatrixView& output,
+                          int* max_indices) const {
+  const auto& k = kernels::active();
+  const bool max = type == PoolingType::MAX;
+  const float identity = max ? -std::numeric_limits<float>::infinity() : 0.0f;
+  // Average pooling: each input counts 1 / (pool_size^2)
+  const float avg_scale = 1.0f / (pool_size * pool_size);
+  const std::ptrdiff_t out_cols = depth * output_height * output_width;
+
+  std::ptrdiff_t units = input.rows * unitsPerImage();
+  parallel::parallelFor(0, units, 1, [&](auto first, auto last) {
+    for (auto i = first; i < last; ++i) {
+      Unit u = unit(i);
+      const kernels::PoolRow& row = u.row;
+      std::ptrdiff_t in_row = input_width * row.pixel_stride;
+      std::ptrdiff_t out_row = output_width * row.pixel_stride;
+      const float* in = input.row(u.image) + u.in;
+      float* out = output.row(u.image) + u.out;
+      int* arg =
+          max_indices ? max_indices + u.image * out_cols + u.out : nullptr;
 
-#pragma omp parallel for
-  for (int b = 0; b < batch_size; ++b) {
-    for (int d = 0; d < depth; ++d) {
       for (int y = 0; y < output_height; ++y) {
+        float* dst = out + y * out_row;
+        int* dst_arg = arg ? arg + y * out_row : nullptr;
         for (int x = 0; x < output_width; ++x) {
-          int start_y = y * stride;
-          int start_x = x * stride;
-          int end_y = std::min(start_y + pool_size, input_height);
-          int end_x = std::min(start_x + pool_size, input_width);
-
-          // --- LOGIC SPLIT ---
-          if (type == PoolingType::MAX) {
-            float max_val = -std::numeric_limits<float>::infinity();
-            int max_idx = -1;
-
-            for (int wy = start_y; wy < end_y; ++wy) {
-              for (int wx = start_x; wx < end_x; ++wx) {
-                int flat_idx =
-                    (d * input_height * input_width) + (wy * input_width) + wx;
-                float val = input(b, flat_idx);
-                if (val > max_val) {
-                  max_val = val;
-                  max_idx = flat_idx;
-                }
-              }
-            }
-            // Write Output
-            int out_idx =
-                (d * output_height * output_width) + (y * output_width) + x;
-            output(b, out_idx) = max_val;
-            if (is_training) max_indices_cache[b][out_idx] = max_idx;
-
-          } else if (type == PoolingType::AVERAGE) {
-            float sum = 0.0f;
-            for (int wy = start_y; wy < end_y; ++wy) {
-              for (int wx = start_x; wx < end_x; ++wx) {
-                int flat_idx =
-                    (d * input_height * input_width) + (wy * input_width) + wx;
-                sum += input(b, flat_idx);
-              }
-            }
-            // Write Output
-            int out_idx =
-                (d * output_height * output_width) + (y * output_width) + x;
-            output(b, out_idx) = sum * avg_scale;
+          std::fill_n(dst + x * row.pixel_stride, row.channels, identity);
+          if (dst_arg) {
+            std::fill_n(dst_arg + x * row.pixel_stride, row.channels, -1);
+          }
+        }
+        for (int wy = 0; wy < pool_size; ++wy) {
+          std::ptrdiff_t offset = (y * stride + wy) * in_row;
+          if (max) {
+            k.pool_max_row(dst, dst_arg, in + offset, u.in + offset, row);
+          } else {
+            k.pool_sum_row(dst, in + offset, avg_scale, row);
           }
         }
       }
     }
-  }
-  return output;
+  });
 }
 
-core::Matrix Pooling2DLayer::backward(const core::Matrix& outputGradients) {
+ConstMatrixView Pooling2DLayer::trainBackward(
+    const ConstMatrixView& outputGradients, ExecutionContext& ctx) {
+  const auto& k = kernels::active();
   int batch_size = outputGradients.rows;
   int input_cols = depth * input_height * input_width;
-  Matrix dX = Matrix::zeros(batch_size, input_cols);
+  MatrixView dX = ctx.buffer(this, INPUT_GRADIENT, batch_size, input_cols);
+  const std::ptrdiff_t out_cols = depth * output_height * output_width;
 
   // Pre-calculate scaling factor for Average pooling gradients
   float avg_grad_scale = 1.0f / (pool_size * pool_size);
 
-#pragma omp parallel for
-  for (int b = 0; b < batch_size; ++b) {
-    // Iterate over the OUTPUT gradient (since it maps to a window in input)
-    for (int d = 0; d < depth; ++d) {
-      for (int y = 0; y < output_height; ++y) {
-        for (int x = 0; x < output_width; ++x) {
-          int out_idx =
-              (d * output_height * output_width) + (y * output_width) + x;
-          float grad = outputGradients(b, out_idx);
-
-          if (type == PoolingType::MAX) {
-            // Route gradient ONLY to the max pixel
-            int max_idx = max_indices_cache[b][out_idx];
-            if (max_idx != -1) {
-// We use atomic add or accumulation if windows overlap
-// (though typically they don't in pooling).
-// Since this loops over 'out_idx', we can write directly if stride >=
-// pool_size. For safety with generic stride, we accumulate.
-#pragma omp atomic
-              dX(b, max_idx) += grad;
-            }
-
-          } else if (type == PoolingType::AVERAGE) {
-            // Distribute gradient EQUALLY to all pixels in window
-            int start_y = y * stride;
-            int start_x = x * stride;
-            int end_y = std::min(start_y + pool_size, input_height);
-            int end_x = std::min(start_x + pool_size, input_width);
-
-            float distributed_grad = grad * avg_grad_scale;
+  // Each unit accumulates into its own channels of dX only, so windows may
+  // overlap (stride < pool_size) without atomics or per-thread copies
+  std::ptrdiff_t units = batch_size * unitsPerImage();
+  parallel::parallelFor(0, units, 1, [&](auto first, auto last) {
+    for (auto i = first; i < last; ++i) {
+      Unit u = unit(i);
+      const kernels::PoolRow& row = u.row;
+      std::ptrdiff_t in_row = input_width * row.pixel_stride;
+      std::ptrdiff_t out_row = output_width * row.pixel_stride;
+      float* image = dX.row(u.image);
+      float* dx = image + u.in;
+      const float* g = outputGradients.row(u.image) + u.out;
 
-            for (int wy = start_y; wy < end_y; ++wy) {
-              for (int wx = start_x; wx < end_x; ++wx) {
-                int flat_idx =
-                    (d * input_height * input_width) + (wy * input_width) + wx;
+      // 1. Zero the unit's part of dX
+      if (row.channels == row.pixel_stride) {
+        std::fill_n(dx, input_height * in_row, 0.0f);
+      } else {
+        for (int p = 0; p < input_height * input_width; ++p) {
+          std::fill_n(dx + p * row.pixel_stride, row.channels, 0.0f);
+        }
+      }
 
-#pragma omp atomic
-                dX(b, flat_idx) += distributed_grad;
-              }
+      for (int y = 0; y < output_height; ++y) {
+        const float* g_row = g + y * out_row;
+        if (type == PoolingType::MAX) {
+          // 2a. Route gradient ONLY to the max pixel (accumulated: windows
+          // overlap when stride < pool_size)
+          const int* arg =
+              max_indices.data() + u.image * out_cols + u.out + y * out_row;
+          for (int x = 0; x < output_width; ++x) {
+            for (int c = 0; c < row.channels; ++c) {
+              int at = arg[x * row.pixel_stride + c];
+              if (at >= 0) image[at] += g_row[x * row.pixel_stride + c];
             }
           }
+        } else {
+          // 2b. Distribute gradient EQUALLY to all pixels in window
+          for (int wy = 0; wy < pool_size; ++wy) {
+            k.pool_spread_row(dx + (y * stride + wy) * in_row, g_row,
+                              avg_grad_scale, row);
+          }
         }
       }
     }
-  }
+  });
   return dX;
 }
 
+std::vector<BufferRequest> Pooling2DLayer::trainingBuffers(
+    size_t batch) const {
+  size_t in_cols = depth * input_height * input_width;
+  size_t out_cols = depth * output_height * output_width;
+  return {{OUTPUT, batch * out_cols, BufferLifetime::SAVED},
+          {INPUT_GRADIENT, batch * in_cols, BufferLifetime::INPUT_GRADIENT}};
+}
+
 Shape Pooling2DLayer::getOutputShape() const {
   return {depth, output_height, output_width};
 }
@@ -193,6 +249,7 @@ std::string Pooling2DLayer::info() const {
   std::string typeStr = (type == PoolingType::MAX) ? "MAX" : "AVG";
   ss << "Pooling Layer [" << typeStr << "] " << input_height << "x"
      << input_width << " -> " << output_height << "x" << output_width;
+  if (layout == Layout::NHWC) ss << " NHWC";
   return ss.str();
 }
 
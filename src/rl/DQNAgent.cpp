@@ -13,7 +13,8 @@ DuelingHead::DuelingHead(size_t input_dim, size_t num_actions,
     : value_stream(input_dim, 1, act, init),
       advantage_stream(input_dim, num_actions, act, init) {}
 
-core::Matrix DuelingHead::forward(const core::Matrix& input, bool is_training) {
+core::Matrix DuelingHead::forward(const core::ConstMatrixView& input,
+                                  bool is_training) {
   // Forward pass through value and advantage streams
   core::Matrix value = value_stream.forward(input, is_training);  // (N, 1)
   core::Matrix advantage =
@@ -266,11 +267,8 @@ void DQNAgent::updateTargetNetwork() {
         Matrix* src = source_params[j];
         Matrix* dst = target_params[j];
 
-        Matrix term1 = (*src) * tau;
-        Matrix term2 = (*dst) * one_minus_tau;
-
-        // Update the target weight in-place
-        *dst = term1 + term2;
+        // Update the target weight in-place (one fused pass, no temporaries)
+        *dst = (*src) * tau + (*dst) * one_minus_tau;
       }
     }
   }
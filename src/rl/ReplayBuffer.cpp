@@ -42,13 +42,13 @@ Experience ReplayBuffer::sample(size_t batch_size) {
   int current = 0;
   while (current < batch_size) {
     auto index = rand() % size_;
-    // Copy data from buffer to batch
-    sample_.states.setRow(current,
-                          buffer_.states.slice(index, index + 1).flatten());
-    sample_.next_states.setRow(
-        current, buffer_.next_states.slice(index, index + 1).flatten());
-    sample_.actions.setRow(current,
-                           buffer_.actions.slice(index, index + 1).flatten());
+    // Copy rows straight from buffer to batch (no temporaries)
+    sample_.states.rowRange(current, current + 1)
+        .copyFrom(buffer_.states.rowRange(index, index + 1));
+    sample_.next_states.rowRange(current, current + 1)
+        .copyFrom(buffer_.next_states.rowRange(index, index + 1));
+    sample_.actions.rowRange(current, current + 1)
+        .copyFrom(buffer_.actions.rowRange(index, index + 1));
     sample_.rewards[current] = buffer_.rewards[index];
     sample_.dones[current] = buffer_.dones[index];
     current++;
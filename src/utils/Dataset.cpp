@@ -1,5 +1,8 @@
 #include "talawa/utils/Dataset.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 #include <random>
 #include <stdexcept>
 namespace talawa {
@@ -13,24 +16,60 @@ void Dataset::shuffle() {
   std::shuffle(indices.begin(), indices.end(), g);
 }
 
+void Dataset::shuffleRows() {
+  std::random_device rd;
+  std::mt19937 g(rd());
+
+  std::vector<int> order(size());
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), g);
+
+  // Gather into fresh storage, then swap in (one pass, one copy per row)
+  Matrix shuffled_features(features.rows, features.cols);
+  Matrix shuffled_labels(labels.rows, labels.cols);
+  for (size_t i = 0; i < order.size(); ++i) {
+    shuffled_features.rowRange(i, i + 1).copyFrom(
+        features.rowRange(order[i], order[i] + 1));
+    shuffled_labels.rowRange(i, i + 1).copyFrom(
+        labels.rowRange(order[i], order[i] + 1));
+  }
+  features = std::move(shuffled_features);
+  labels = std::move(shuffled_labels);
+
+  indices.resize(size());
+  std::iota(indices.begin(), indices.end(), 0);
+}
+
 void Dataset::splice(size_t start, size_t end, Matrix& feature_batch,
                      Matrix& label_batch) {
   if (start < 0 || end > size() || start >= end) {
     throw std::out_of_range("Dataset::splice indices out of bounds");
   }
   size_t batch_size = end - start;
-  feature_batch = Matrix(batch_size, features.cols);
-  label_batch = Matrix(batch_size, labels.cols);
+  // Reuse the caller's buffers across batches of the same size
+  if (feature_batch.rows != batch_size || feature_batch.cols != features.cols) {
+    feature_batch = Matrix(batch_size, features.cols);
+  }
+  if (label_batch.rows != batch_size || label_batch.cols != labels.cols) {
+    label_batch = Matrix(batch_size, labels.cols);
+  }
 
   for (size_t i = 0; i < batch_size; ++i) {
     size_t idx = indices[start + i];
-    for (size_t j = 0; j < features.cols; ++j) {
-      feature_batch(i, j) = features(idx, j);
-    }
-    for (size_t j = 0; j < labels.cols; ++j) {
-      label_batch(i, j) = labels(idx, j);
-    }
+    std::memcpy(feature_batch.rawData() + i * features.cols,
+                features.rawData() + idx * features.cols,
+                features.cols * sizeof(float));
+    std::memcpy(label_batch.rawData() + i * labels.cols,
+                labels.rawData() + idx * labels.cols,
+                labels.cols * sizeof(float));
+  }
+}
+
+Dataset::Batch Dataset::batch(size_t start, size_t end) const {
+  if (end > size() || start >= end) {
+    throw std::out_of_range("Dataset::batch indices out of bounds");
   }
+  return {features.rowRange(start, end), labels.rowRange(start, end)};
 }
 
 }  // namespace utils
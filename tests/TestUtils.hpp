@@ -0,0 +1,22 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "talawa/core/MatrixView.hpp"
+
+// Helpers shared by the test executables (tests/*.test.cpp)
+
+// Largest |a - b|, relative to the largest |b| (at least 1)
+inline float relative_error(const talawa::core::ConstMatrixView& a,
+                            const talawa::core::ConstMatrixView& b) {
+  assert(a.rows == b.rows && a.cols == b.cols);
+  float diff = 0.0f, scale = 1.0f;
+  for (size_t r = 0; r < a.rows; ++r) {
+    for (size_t c = 0; c < a.cols; ++c) {
+      diff = std::max(diff, std::abs(a(r, c) - b(r, c)));
+      scale = std::max(scale, std::abs(b(r, c)));
+    }
+  }
+  return diff / scale;
+}
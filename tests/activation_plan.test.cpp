@@ -0,0 +1,174 @@
+#include "talawa/neuralnetwork/ActivationPlan.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+std::unique_ptr<NeuralNetwork> make_cnn() {
+  return NeuralNetworkBuilder::create({2, 10, 10})
+      .add(Conv2DLayerConfig{.filters = 4, .kernel_size = 3, .padding = 1})
+      .add(Pooling2DLayerConfig{.type = PoolingType::MAX})
+      .add(Conv2DLayerConfig{
+          .filters = 3, .kernel_size = 2, .act = Activation::SOFTMAX})
+      .add(Pooling2DLayerConfig{.type = PoolingType::AVERAGE})
+      .add(DenseLayerConfig{.neurons = 8, .act = Activation::TANH})
+      .add(DenseLayerConfig{.neurons = 3, .act = Activation::LINEAR})
+      .build();
+}
+
+// Forward/backward through each layer's self-contained API
+float layer_by_layer(NeuralNetwork& net, const Matrix& x, const Matrix& y) {
+  Matrix output = x;
+  for (auto& layer : net.layers) output = layer->forward(output, true);
+  float loss = net.loss_fn->calculate(output, y);
+  Matrix gradient = net.loss_fn->gradient(output, y);
+  for (size_t i = net.layers.size(); i-- > 0;) {
+    gradient = net.layers[i]->backward(gradient);
+  }
+  return loss;
+}
+
+bool same_gradients(NeuralNetwork& a, NeuralNetwork& b) {
+  const float* ga = a.gradientData();
+  const float* gb = b.gradientData();
+  for (int i = 0; i < a.getTotalParameters(); ++i) {
+    if (std::abs(ga[i] - gb[i]) > 1e-5f) return false;
+  }
+  return true;
+}
+
+void test_matches_layer_api() {
+  std::cout << "[Test] Planned step matches the layer-by-layer step... ";
+
+  auto planned = make_cnn();
+  auto reference = planned->clone();
+  Matrix x = Matrix::random(7, 200);
+  Matrix y = Matrix::random(7, 3);
+
+  float loss = planned->computeGradients(x, y);
+  float expected = layer_by_layer(*reference, x, y);
+  assert(std::abs(loss - expected) < 1e-5f);
+  assert(same_gradients(*planned, *reference));
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_batch_sizes() {
+  std::cout << "[Test] Smaller batches reuse the plan, larger ones "
+               "replan... ";
+
+  auto net = make_cnn();
+  Matrix x = Matrix::random(16, 200);
+  Matrix y = Matrix::random(16, 3);
+
+  net->planTraining(8);
+  const ActivationPlan* plan = net->activationPlan();
+  for (size_t batch : {8, 3, 8}) {
+    auto reference = net->clone();
+    net->computeGradients(ConstMatrixView(x).rowRange(0, batch),
+                          ConstMatrixView(y).rowRange(0, batch));
+    layer_by_layer(*reference, Matrix(ConstMatrixView(x).rowRange(0, batch)),
+                   Matrix(ConstMatrixView(y).rowRange(0, batch)));
+    assert(same_gradients(*net, *reference));
+    assert(net->activationPlan() == plan);
+  }
+
+  net->computeGradients(x, y);
+  assert(net->activationPlan()->batch() == 16);
+
+  // A copy plans for itself
+  auto copy = net->clone();
+  assert(copy->activationPlan() == nullptr);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_memory_reuse() {
+  std::cout << "[Test] Buffers share memory by liveness... " << std::endl;
+
+  auto builder = NeuralNetworkBuilder::create({3, 32, 32});
+  for (int i = 0; i < 6; ++i) {
+    builder.add(Conv2DLayerConfig{
+        .filters = 16, .kernel_size = 3, .padding = 1});
+  }
+  auto net = builder.add(Pooling2DLayerConfig{})
+                 .add(DenseLayerConfig{.neurons = 10})
+                 .build();
+  net->planTraining(32);
+  const ActivationPlan* plan = net->activationPlan();
+
+  std::cout << "  Unshared: " << plan->unsharedBytes() / (1 << 20)
+            << " MB, planned arena: " << plan->arenaBytes() / (1 << 20)
+            << " MB" << std::endl;
+  assert(plan->arenaBytes() > 0);
+  assert(plan->arenaBytes() * 2 < plan->unsharedBytes());
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+std::unique_ptr<NeuralNetwork> make_deep_cnn(size_t segment_layers) {
+  auto builder = NeuralNetworkBuilder::create({3, 16, 16});
+  for (int i = 0; i < 8; ++i) {
+    builder.add(Conv2DLayerConfig{
+        .filters = 8, .kernel_size = 3, .padding = 1});
+  }
+  return builder.add(Pooling2DLayerConfig{})
+      .add(DenseLayerConfig{.neurons = 10})
+      .setCheckpointing(segment_layers)
+      .build();
+}
+
+void test_checkpointing() {
+  std::cout << "[Test] Checkpointed steps match full ones... " << std::endl;
+
+  auto full = make_deep_cnn(0);
+  Matrix x = Matrix::random(16, 3 * 16 * 16);
+  Matrix y = Matrix::random(16, 10);
+  float expected = full->computeGradients(x, y);
+  size_t full_bytes = full->activationPlan()->arenaBytes();
+  assert(full->activationPlan()->recomputedLayers() == 0);
+
+  for (size_t segment : {2, 3, 4}) {
+    auto net = full->clone();
+    net->setCheckpointing(segment);
+    float loss = net->computeGradients(x, y);
+    const ActivationPlan* plan = net->activationPlan();
+
+    // 10 layers in segments of 'segment': all but the last segment rerun
+    // every layer except their checkpoint
+    size_t segments = (10 + segment - 1) / segment;
+    assert(plan->recomputedLayers() == (segments - 1) * (segment - 1));
+    assert(std::abs(loss - expected) < 1e-6f);
+    assert(same_gradients(*net, *full));
+    assert(plan->arenaBytes() < full_bytes);
+
+    std::cout << "  Segments of " << segment << ": "
+              << plan->arenaBytes() / 1024 << " KB vs "
+              << full_bytes / 1024 << " KB" << std::endl;
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << " RUNNING ACTIVATION PLAN   " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  test_matches_layer_api();
+  test_batch_sizes();
+  test_memory_reuse();
+  test_checkpointing();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
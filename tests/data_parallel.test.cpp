@@ -0,0 +1,106 @@
+#include "talawa/neuralnetwork/DataParallelTrainer.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "talawa/core/Parallel.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+bool same_weights(NeuralNetwork& a, NeuralNetwork& b, float tol) {
+  auto pa = a.parameters(), pb = b.parameters();
+  if (pa.size() != pb.size()) return false;
+  for (size_t i = 0; i < pa.size(); ++i) {
+    for (size_t j = 0; j < pa[i]->size(); ++j) {
+      if (std::abs(pa[i]->rawData()[j] - pb[i]->rawData()[j]) > tol) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Trains a copy serially on the whole batch and the original data-parallel,
+// then compares the weights after every step
+void check_matches_serial(NeuralNetwork& net, size_t inputs, size_t outputs,
+                          size_t batch, int replicas, const char* name) {
+  std::cout << "[Test] Data-parallel step matches serial (" << name
+            << ")... ";
+
+  auto serial = net.clone();
+  DataParallelTrainer trainer(net, replicas);
+  assert(trainer.replicaCount() == replicas);
+
+  Matrix X = Matrix::random(batch, inputs);
+  Matrix Y = Matrix::random(batch, outputs);
+  for (int step = 0; step < 5; ++step) {
+    float expected = serial->train(X, Y);
+    float loss = trainer.train(X, Y);
+    assert(std::abs(loss - expected) < 1e-4f * (1.0f + std::abs(expected)));
+    assert(same_weights(net, *serial, 1e-4f));
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_mlp_adam() {
+  auto net = NeuralNetworkBuilder::create({1, 1, 20})
+                 .add(DenseLayerConfig{.neurons = 32, .act = Activation::TANH})
+                 .add(DenseLayerConfig{.neurons = 6, .act = Activation::LINEAR})
+                 .setOptimizer(std::make_unique<Adam>())
+                 .setLossFunction(std::make_unique<loss::CrossEntropyLoss>())
+                 .build(0.01f);
+  // 45 rows over 4 replicas: uneven shards must be weighted by size
+  check_matches_serial(*net, 20, 6, 45, 4, "MLP, Adam, uneven shards");
+}
+
+void test_cnn_sgd() {
+  auto net =
+      NeuralNetworkBuilder::create({2, 8, 8})
+          .add(Conv2DLayerConfig{.filters = 4, .kernel_size = 3, .padding = 1})
+          .add(Pooling2DLayerConfig{.type = PoolingType::MAX})
+          .add(DenseLayerConfig{.neurons = 3, .act = Activation::SIGMOID})
+          .build(0.05f);
+  check_matches_serial(*net, 128, 3, 64, 3, "CNN, SGD");
+}
+
+void test_small_batch() {
+  std::cout << "[Test] Small batches use fewer replicas... ";
+
+  auto net = NeuralNetworkBuilder::create({1, 1, 4})
+                 .add(DenseLayerConfig{.neurons = 2})
+                 .build();
+  auto serial = net->clone();
+  DataParallelTrainer trainer(*net, 8);
+
+  // Fewer rows than MIN_SHARD_ROWS: one shard, same as train()
+  Matrix X = Matrix::random(3, 4), Y = Matrix::random(3, 2);
+  serial->train(X, Y);
+  trainer.train(X, Y);
+  assert(same_weights(*net, *serial, 1e-6f));
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << " RUNNING DATA-PARALLEL TESTS" << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  // Real worker threads even on small machines
+  parallel::setThreadBudget(4);
+
+  test_mlp_adam();
+  test_cnn_sgd();
+  test_small_batch();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
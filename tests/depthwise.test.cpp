@@ -0,0 +1,219 @@
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+#include "TestUtils.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+// Row of tap t, channel c in a full convolution's (K*K*D, Filters) kernels
+int kernel_row(Layout layout, int taps, int depth, int t, int c) {
+  return layout == Layout::NHWC ? t * depth + c : c * taps + t;
+}
+
+// Largest relative error of a depthwise layer against a full convolution
+// whose kernels connect channel c to filter c only, over the output, dX and
+// both parameter gradients of one batch
+float error_against_conv(int depth, int height, int width, int kernel,
+                         int stride, int padding, Layout layout,
+                         Activation act = Activation::RELU) {
+  int taps = kernel * kernel;
+  DepthwiseConv2DLayer dw(depth, height, width, kernel, stride, padding,
+                          Initializer::GLOROT_UNIFORM, act, layout);
+  Conv2DLayer full(depth, height, width, depth, kernel, stride, padding,
+                   Initializer::GLOROT_UNIFORM, act, layout,
+                   ConvAlgorithm::GEMM);
+  Matrix& kernels = *dw.getParameters()[0];
+  Matrix& full_kernels = *full.getParameters()[0];
+  full_kernels.fill(0.0f);
+  for (int t = 0; t < taps; ++t) {
+    for (int c = 0; c < depth; ++c) {
+      full_kernels(kernel_row(layout, taps, depth, t, c), c) = kernels(t, c);
+    }
+  }
+  *dw.getParameters()[1] = Matrix::random(1, depth);
+  *full.getParameters()[1] = *dw.getParameters()[1];
+
+  Matrix X = Matrix::random(3, depth * height * width);
+  Matrix want = full.forward(X);
+  float worst = relative_error(dw.forward(X), want);
+  worst = std::max(worst, relative_error(dw.forward(X, false), want));
+
+  Matrix dY = Matrix::random(want.rows, want.cols);
+  Matrix dX_want = full.backward(dY);
+  worst = std::max(worst, relative_error(dw.backward(dY), dX_want));
+  Matrix dW_want(taps, depth);
+  const Matrix& full_dW = *full.getParameterGradients()[0];
+  for (int t = 0; t < taps; ++t) {
+    for (int c = 0; c < depth; ++c) {
+      dW_want(t, c) = full_dW(kernel_row(layout, taps, depth, t, c), c);
+    }
+  }
+  worst = std::max(
+      worst, relative_error(*dw.getParameterGradients()[0], dW_want));
+  worst = std::max(worst, relative_error(*dw.getParameterGradients()[1],
+                                         *full.getParameterGradients()[1]));
+  return worst;
+}
+
+void test_matches_conv() {
+  std::cout << "[Test] Depthwise matches a channel-diagonal Conv2D... ";
+
+  for (Layout layout : {Layout::NCHW, Layout::NHWC}) {
+    assert(error_against_conv(3, 8, 8, 3, 1, 0, layout) < 1e-5f);
+    assert(error_against_conv(5, 9, 7, 3, 1, 1, layout, Activation::TANH) <
+           1e-5f);
+    // A single channel vectorises along the row instead of across channels
+    assert(error_against_conv(1, 6, 6, 2, 1, 0, layout) < 1e-5f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_strides() {
+  std::cout << "[Test] Strided depthwise convolutions... ";
+
+  for (Layout layout : {Layout::NCHW, Layout::NHWC}) {
+    assert(error_against_conv(4, 11, 10, 3, 2, 1, layout,
+                              Activation::SIGMOID) < 1e-5f);
+    assert(error_against_conv(2, 12, 12, 5, 2, 2, layout,
+                              Activation::LINEAR) < 1e-5f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_many_channels() {
+  std::cout << "[Test] Depthwise over several weight-gradient blocks... ";
+
+  // The NHWC weight gradient is split into blocks of 16 channels
+  assert(error_against_conv(37, 6, 6, 3, 1, 1, Layout::NHWC) < 1e-5f);
+  assert(error_against_conv(37, 6, 6, 3, 1, 1, Layout::NCHW) < 1e-5f);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_rejects_softmax() {
+  std::cout << "[Test] Depthwise rejects softmax... ";
+
+  bool threw = false;
+  try {
+    DepthwiseConv2DLayer(2, 4, 4, 3, 1, 0, Initializer::GLOROT_UNIFORM,
+                         Activation::SOFTMAX);
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+// 1x1 convolutions take the plain GEMM; a padded 3x3 whose only non-zero
+// tap is the centre computes the same through the implicit GEMM
+void check_pointwise(Layout layout) {
+  int D = 6, H = 5, W = 7, F = 4;
+  Conv2DLayer pointwise(D, H, W, F, 1, 1, 0, Initializer::GLOROT_UNIFORM,
+                        Activation::RELU, layout);
+  Conv2DLayer centre(D, H, W, F, 3, 1, 1, Initializer::GLOROT_UNIFORM,
+                     Activation::RELU, layout, ConvAlgorithm::GEMM);
+  Matrix& centre_kernels = *centre.getParameters()[0];
+  const Matrix& kernels = *pointwise.getParameters()[0];
+  centre_kernels.fill(0.0f);
+  for (int c = 0; c < D; ++c) {
+    for (int f = 0; f < F; ++f) {
+      centre_kernels(kernel_row(layout, 9, D, 4, c), f) = kernels(c, f);
+    }
+  }
+
+  Matrix X = Matrix::random(3, D * H * W);
+  Matrix want = centre.forward(X);
+  assert(relative_error(pointwise.forward(X), want) < 1e-5f);
+  assert(relative_error(pointwise.forward(X, false), want) < 1e-5f);
+
+  Matrix dY = Matrix::random(want.rows, want.cols);
+  Matrix dX = pointwise.backward(dY);
+  assert(relative_error(dX, centre.backward(dY)) < 1e-5f);
+  const Matrix& dW = *pointwise.getParameterGradients()[0];
+  const Matrix& centre_dW = *centre.getParameterGradients()[0];
+  for (int c = 0; c < D; ++c) {
+    for (int f = 0; f < F; ++f) {
+      float want_dw = centre_dW(kernel_row(layout, 9, D, 4, c), f);
+      assert(std::abs(dW(c, f) - want_dw) < 1e-4f);
+    }
+  }
+}
+
+void test_pointwise() {
+  std::cout << "[Test] Pointwise convolutions as plain GEMMs... ";
+
+  check_pointwise(Layout::NCHW);
+  check_pointwise(Layout::NHWC);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_network(Layout layout) {
+  Shape input{3, 10, 10};
+  auto net = NeuralNetworkBuilder::create(input)
+                 .add(DepthwiseConv2DLayerConfig{.padding = 1})
+                 .add(Conv2DLayerConfig{.filters = 8, .kernel_size = 1})
+                 .add(DepthwiseConv2DLayerConfig{.stride = 2})
+                 .add(Conv2DLayerConfig{.filters = 8, .kernel_size = 1})
+                 .add(DenseLayerConfig{.neurons = 4,
+                                       .act = Activation::LINEAR})
+                 .setLayout(layout)
+                 .build(0.01f);
+
+  Matrix X = Matrix::random(4, input.flat());
+  Matrix Y = Matrix::random(4, 4);
+  for (int i = 0; i < 3; ++i) net->train(X, Y);
+  Matrix want = net->predict(X);
+
+  // Save / load
+  assert(net->saveToFile("test_depthwise.nn"));
+  auto loaded = NeuralNetwork::loadFromFile("test_depthwise.nn");
+  assert(loaded);
+  std::remove("test_depthwise.nn");
+  std::remove("test_depthwise.nn.yaml");
+  auto* dw =
+      dynamic_cast<DepthwiseConv2DLayer*>(loaded->getLayers()[0].get());
+  assert(dw && dw->getLayout() == layout);
+  assert(relative_error(loaded->predict(X), want) < 1e-6f);
+
+  // Clone, and the compiled inference plan
+  assert(relative_error(net->clone()->predict(X), want) < 1e-6f);
+  InferencePlan plan = net->compileForInference(4);
+  assert(relative_error(plan.predict(X), want) < 1e-5f);
+}
+
+void test_save_load() {
+  std::cout << "[Test] Separable networks save, load and compile... ";
+
+  test_network(Layout::NCHW);
+  test_network(Layout::NHWC);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << "   RUNNING DEPTHWISE TESTS " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  test_matches_conv();
+  test_strides();
+  test_many_channels();
+  test_rejects_softmax();
+  test_pointwise();
+  test_save_load();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
@@ -0,0 +1,171 @@
+#include "talawa/neuralnetwork/DistributedTrainer.hpp"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <memory>
+
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+constexpr int WORKERS = 3;
+
+// Same data in every process, without sharing a random seed
+Matrix pattern(size_t rows, size_t cols, float phase) {
+  Matrix m(rows, cols);
+  for (size_t i = 0; i < rows; ++i)
+    for (size_t j = 0; j < cols; ++j)
+      m(i, j) = std::sin(phase + 0.37f * i + 0.11f * j);
+  return m;
+}
+
+std::unique_ptr<NeuralNetwork> make_cnn() {
+  return NeuralNetworkBuilder::create({2, 6, 6})
+      .add(Conv2DLayerConfig{.filters = 3, .kernel_size = 3, .padding = 1})
+      .add(Pooling2DLayerConfig{.type = PoolingType::MAX})
+      .add(DenseLayerConfig{.neurons = 4, .act = Activation::TANH})
+      .build(0.05f);
+}
+
+// Forks one process per worker, each running worker(rank, config); passes
+// if every one of them exits with 0
+bool run_workers(const std::function<bool(const DistributedConfig&)>& worker) {
+  static int run = 0;
+  DistributedConfig base;
+  base.world_size = WORKERS;
+  base.master_port = 20000 + (getpid() * 7 + run++) % 20000;
+  base.timeout_ms = 10'000;
+
+  std::cout.flush();
+  for (int rank = 0; rank < WORKERS; ++rank) {
+    if (fork() == 0) {
+      alarm(60);  // A hung ring must not hang the test
+      DistributedConfig config = base;
+      config.rank = rank;
+      bool ok = false;
+      try {
+        ok = worker(config);
+      } catch (const std::exception& e) {
+        std::cerr << "[rank " << rank << "] " << e.what() << std::endl;
+      }
+      _exit(ok ? 0 : 1);
+    }
+  }
+
+  bool all_ok = true;
+  for (int i = 0; i < WORKERS; ++i) {
+    int status = 0;
+    wait(&status);
+    all_ok &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  }
+  return all_ok;
+}
+
+void test_matches_serial() {
+  std::cout << "[Test] Ring all-reduce matches serial training... ";
+
+  bool ok = run_workers([](const DistributedConfig& config) {
+    auto net = make_cnn();
+    DistributedTrainer trainer(*net, config);
+    // Reference: one process training on every worker's rows at once
+    auto serial = net->clone();
+
+    const size_t rows = 4;
+    Matrix X = pattern(rows * WORKERS, 72, 0.0f);
+    Matrix Y = pattern(rows * WORKERS, 4, 1.0f);
+    ConstMatrixView x = ConstMatrixView(X).rowRange(config.rank * rows,
+                                                    (config.rank + 1) * rows);
+    ConstMatrixView y = ConstMatrixView(Y).rowRange(config.rank * rows,
+                                                    (config.rank + 1) * rows);
+    for (int step = 0; step < 5; ++step) {
+      float expected = serial->train(X, Y);
+      float loss = trainer.train(x, y);
+      if (std::abs(loss - expected) > 1e-4f) return false;
+    }
+
+    auto mine = net->parameters(), reference = serial->parameters();
+    for (size_t i = 0; i < mine.size(); ++i)
+      for (size_t j = 0; j < mine[i]->size(); ++j)
+        if (std::abs(mine[i]->rawData()[j] - reference[i]->rawData()[j]) >
+            1e-4f) {
+          return false;
+        }
+    return trainer.parametersInSync();
+  });
+  assert(ok);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_detects_divergence() {
+  std::cout << "[Test] Diverged parameters are detected and repaired... ";
+
+  bool ok = run_workers([](const DistributedConfig& config) {
+    auto net = make_cnn();
+    DistributedTrainer trainer(*net, config);
+    if (!trainer.parametersInSync()) return false;
+
+    // One worker drifts: everyone must see it
+    if (config.rank == 1) net->parameters()[0]->rawData()[0] += 1e-3f;
+    if (trainer.parametersInSync()) return false;
+
+    trainer.broadcastParameters();
+    return trainer.parametersInSync();
+  });
+  assert(ok);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int open_fds() {
+  auto fds = std::filesystem::directory_iterator("/proc/self/fd");
+  return std::distance(begin(fds), end(fds));
+}
+
+void test_timeout_closes_sockets() {
+  std::cout << "[Test] A timed-out rendezvous closes its sockets... ";
+
+  // Rank 0 of two, with nobody coming: every attempt must throw and leave
+  // no descriptors behind
+  DistributedConfig config;
+  config.world_size = 2;
+  config.master_port = 20000 + (getpid() * 11) % 20000;
+  config.timeout_ms = 50;
+  auto net = make_cnn();
+  int before = open_fds();
+  for (int attempt = 0; attempt < 3; ++attempt) {
+    bool threw = false;
+    try {
+      DistributedTrainer trainer(*net, config);
+    } catch (const std::runtime_error&) {
+      threw = true;
+    }
+    assert(threw);
+  }
+  assert(open_fds() == before);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << "  RUNNING DISTRIBUTED TESTS " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  test_matches_serial();
+  test_detects_divergence();
+  test_timeout_closes_sockets();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
@@ -0,0 +1,192 @@
+#include "talawa/neuralnetwork/InferencePlan.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "talawa/core/Allocator.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+// Every heap allocation in the process, pooled or not
+std::atomic<long> heap_allocations{0};
+
+void* operator new(size_t size) {
+  heap_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+bool same(const ConstMatrixView& a, const Matrix& b) {
+  if (a.rows != b.rows || a.cols != b.cols) return false;
+  for (size_t i = 0; i < a.rows; ++i)
+    for (size_t j = 0; j < a.cols; ++j)
+      if (std::abs(a(i, j) - b(i, j)) > 1e-5f) return false;
+  return true;
+}
+
+void check_matches_predict(NeuralNetwork& net, size_t inputs,
+                           const char* name) {
+  std::cout << "[Test] Plan matches predict (" << name << ")... ";
+
+  InferencePlan plan = net.compileForInference(16);
+  assert(plan.inputSize() == inputs);
+
+  Matrix X = Matrix::random(16, inputs);
+  for (size_t batch : {1, 5, 16}) {
+    ConstMatrixView rows = ConstMatrixView(X).rowRange(0, batch);
+    assert(same(plan.predict(rows), net.predict(rows)));
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_mlp() {
+  auto net = NeuralNetworkBuilder::create({1, 1, 37})
+                 .add(DenseLayerConfig{.neurons = 64, .act = Activation::RELU})
+                 .add(DenseLayerConfig{.neurons = 33, .act = Activation::TANH})
+                 .add(DenseLayerConfig{.neurons = 10,
+                                       .act = Activation::SOFTMAX})
+                 .build();
+  check_matches_predict(*net, 37, "MLP");
+}
+
+void test_cnn() {
+  auto net =
+      NeuralNetworkBuilder::create({2, 9, 9})
+          .add(Conv2DLayerConfig{.filters = 5, .kernel_size = 3, .padding = 1})
+          .add(Pooling2DLayerConfig{.type = PoolingType::MAX})
+          .add(Conv2DLayerConfig{
+              .filters = 3, .kernel_size = 2, .act = Activation::SIGMOID})
+          .add(DenseLayerConfig{.neurons = 4, .act = Activation::LINEAR})
+          .build();
+  check_matches_predict(*net, 2 * 9 * 9, "CNN");
+}
+
+void test_no_allocations() {
+  std::cout << "[Test] Plan predict does not allocate... ";
+
+  // Every conv path: Winograd (3x3 stride 1), implicit GEMM (stride 2,
+  // 5x5) and the plain GEMM of a 1x1
+  auto net =
+      NeuralNetworkBuilder::create({1, 12, 12})
+          .add(Conv2DLayerConfig{.filters = 4, .kernel_size = 3})
+          .add(Conv2DLayerConfig{.filters = 4, .kernel_size = 3, .stride = 2})
+          .add(Conv2DLayerConfig{.filters = 4, .kernel_size = 5, .padding = 2})
+          .add(Conv2DLayerConfig{.filters = 6, .kernel_size = 1})
+          .add(DenseLayerConfig{.neurons = 16})
+          .add(DenseLayerConfig{.neurons = 3})
+          .build();
+  InferencePlan plan = net->compileForInference();
+  Matrix x = Matrix::random(1, 144);
+  plan.predict(x);  // Warm up per-thread GEMM scratch
+
+  memory::pool().resetStats();
+  long before = heap_allocations.load();
+  for (int i = 0; i < 1000; ++i) plan.predict(x);
+  assert(heap_allocations.load() == before);
+  auto stats = memory::pool().stats();
+  assert(stats.hits == 0 && stats.misses == 0);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_frozen_weights() {
+  std::cout << "[Test] Plan keeps the weights it was compiled with... ";
+
+  auto net = NeuralNetworkBuilder::create({1, 1, 6})
+                 .add(DenseLayerConfig{.neurons = 4, .act = Activation::TANH})
+                 .build(0.5f);
+  Matrix x = Matrix::random(3, 6);
+  InferencePlan plan = net->compileForInference(3);
+  Matrix before = net->predict(x);
+
+  net->train(x, Matrix::random(3, 4));
+  assert(!same(plan.predict(x), net->predict(x)));
+  assert(same(plan.predict(x), before));
+
+  // Too many rows or the wrong width are rejected
+  bool threw = false;
+  try {
+    plan.predict(Matrix::random(4, 6));
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_shared_across_threads() {
+  std::cout << "[Test] Threads share one network and one plan... ";
+
+  auto net = NeuralNetworkBuilder::create({2, 8, 8})
+                 .add(Conv2DLayerConfig{.filters = 4, .kernel_size = 3})
+                 .add(Pooling2DLayerConfig{})
+                 .add(DenseLayerConfig{.neurons = 5,
+                                       .act = Activation::SOFTMAX})
+                 .build();
+  const NeuralNetwork& shared = *net;
+  const InferencePlan plan = net->compileForInference(4);
+
+  std::vector<Matrix> inputs, expected;
+  for (int t = 0; t < 8; ++t) {
+    inputs.push_back(Matrix::random(4, 128));
+    expected.push_back(shared.predict(inputs.back()));
+  }
+
+  // Each thread owns only its contexts; weights are never copied
+  std::vector<int> ok(inputs.size(), 1);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < inputs.size(); ++t) {
+    threads.emplace_back([&, t] {
+      ExecutionContext ctx;
+      ExecutionContext plan_ctx = plan.createContext();
+      for (int i = 0; i < 200; ++i) {
+        if (!same(shared.predict(inputs[t], ctx), expected[t]) ||
+            !same(plan.predict(inputs[t], plan_ctx), expected[t])) {
+          ok[t] = 0;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  for (int v : ok) assert(v);
+
+  // A warm context serves later calls without allocating
+  ExecutionContext ctx;
+  shared.predict(inputs[0], ctx);
+  size_t held = ctx.capacity();
+  shared.predict(inputs[1].view().rowRange(0, 2), ctx);
+  assert(ctx.capacity() == held);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << "  RUNNING INFERENCE TESTS  " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  test_mlp();
+  test_cnn();
+  test_no_allocations();
+  test_frozen_weights();
+  test_shared_across_threads();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
@@ -0,0 +1,178 @@
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+// Position of channel-major element i in the channels-last order
+using Permutation = std::function<size_t(size_t)>;
+
+Permutation nchw_to_nhwc(Shape s) {
+  return [s](size_t i) {
+    size_t c = i / (s.height * s.width), p = i % (s.height * s.width);
+    return p * s.depth + c;
+  };
+}
+
+// Conv kernel rows: (Depth, KernelY, KernelX) -> (KernelY, KernelX, Depth)
+Permutation kernel_rows(size_t depth, size_t k) {
+  return [=](size_t i) {
+    size_t c = i / (k * k), tap = i % (k * k);
+    return tap * depth + c;
+  };
+}
+
+Matrix permute_cols(const ConstMatrixView& m, const Permutation& to) {
+  Matrix out(m.rows, m.cols);
+  for (size_t r = 0; r < m.rows; ++r)
+    for (size_t c = 0; c < m.cols; ++c) out(r, to(c)) = m(r, c);
+  return out;
+}
+
+Matrix permute_rows(const ConstMatrixView& m, const Permutation& to) {
+  Matrix out(m.rows, m.cols);
+  for (size_t r = 0; r < m.rows; ++r)
+    for (size_t c = 0; c < m.cols; ++c) out(to(r), c) = m(r, c);
+  return out;
+}
+
+bool same(const ConstMatrixView& a, const ConstMatrixView& b,
+          float tol = 1e-5f) {
+  if (a.rows != b.rows || a.cols != b.cols) return false;
+  for (size_t r = 0; r < a.rows; ++r)
+    for (size_t c = 0; c < a.cols; ++c)
+      if (std::abs(a(r, c) - b(r, c)) > tol) return false;
+  return true;
+}
+
+const Shape INPUT = {2, 8, 8};
+
+std::unique_ptr<NeuralNetwork> make_cnn(Layout layout) {
+  return NeuralNetworkBuilder::create(INPUT)
+      .add(Conv2DLayerConfig{.filters = 4, .kernel_size = 3, .padding = 1})
+      .add(Pooling2DLayerConfig{.type = PoolingType::MAX})
+      .add(Conv2DLayerConfig{
+          .filters = 3, .kernel_size = 2, .act = Activation::SOFTMAX})
+      .add(Pooling2DLayerConfig{
+          .type = PoolingType::AVERAGE, .pool_size = 2, .stride = 1})
+      .add(DenseLayerConfig{.neurons = 5, .act = Activation::LINEAR})
+      .setLayout(layout)
+      .build();
+}
+
+// For each parameter of the NCHW network, where its elements go in NHWC
+std::vector<Permutation> parameter_maps(NeuralNetwork& net) {
+  std::vector<Permutation> maps;  // Over each parameter's rows
+  Permutation none = [](size_t i) { return i; };
+  Shape shape = INPUT;
+  for (const auto& layer : net.getLayers()) {
+    if (auto* conv = dynamic_cast<Conv2DLayer*>(layer.get())) {
+      size_t k = static_cast<size_t>(std::lround(
+          std::sqrt(conv->getParameters()[0]->rows / shape.depth)));
+      maps.push_back(kernel_rows(shape.depth, k));
+      maps.push_back(none);
+    } else if (dynamic_cast<DenseLayer*>(layer.get())) {
+      // The flatten order of the previous image changes with the layout
+      maps.push_back(nchw_to_nhwc(shape));
+      maps.push_back(none);
+    }
+    shape = layer->getOutputShape();
+  }
+  return maps;
+}
+
+void copy_weights(NeuralNetwork& nchw, NeuralNetwork& nhwc) {
+  auto maps = parameter_maps(nchw);
+  auto from = nchw.parameters(), to = nhwc.parameters();
+  assert(from.size() == maps.size() && to.size() == maps.size());
+  for (size_t i = 0; i < maps.size(); ++i) {
+    to[i]->assign(permute_rows(*from[i], maps[i]));
+  }
+}
+
+void test_same_function() {
+  std::cout << "[Test] NHWC network computes the NCHW one's function... ";
+
+  auto nchw = make_cnn(Layout::NCHW);
+  auto nhwc = make_cnn(Layout::NHWC);
+  copy_weights(*nchw, *nhwc);
+
+  Matrix X = Matrix::random(6, INPUT.flat());
+  Matrix X_nhwc = permute_cols(X, nchw_to_nhwc(INPUT));
+  assert(same(nchw->predict(X), nhwc->predict(X_nhwc)));
+
+  InferencePlan plan = nhwc->compileForInference(6);
+  assert(same(plan.predict(X_nhwc), nchw->predict(X)));
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_same_gradients() {
+  std::cout << "[Test] NHWC gradients are the NCHW ones, permuted... ";
+
+  auto nchw = make_cnn(Layout::NCHW);
+  auto nhwc = make_cnn(Layout::NHWC);
+  copy_weights(*nchw, *nhwc);
+
+  Matrix X = Matrix::random(6, INPUT.flat());
+  Matrix Y = Matrix::random(6, 5);
+  float loss = nchw->computeGradients(X, Y);
+  float loss_nhwc =
+      nhwc->computeGradients(permute_cols(X, nchw_to_nhwc(INPUT)), Y);
+  assert(std::abs(loss - loss_nhwc) < 1e-5f);
+
+  auto maps = parameter_maps(*nchw);
+  auto grads = nchw->gradients(), grads_nhwc = nhwc->gradients();
+  for (size_t i = 0; i < maps.size(); ++i) {
+    assert(same(permute_rows(*grads[i], maps[i]), *grads_nhwc[i]));
+  }
+
+  // Both train the same way from there
+  nchw->applyGradients();
+  nhwc->applyGradients();
+  assert(same(nchw->predict(X),
+              nhwc->predict(permute_cols(X, nchw_to_nhwc(INPUT)))));
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_save_load() {
+  std::cout << "[Test] NHWC layers save and load their layout... ";
+
+  auto net = make_cnn(Layout::NHWC);
+  assert(net->saveToFile("test_layout.nn"));
+  auto loaded = NeuralNetwork::loadFromFile("test_layout.nn");
+  assert(loaded);
+  auto* conv = dynamic_cast<Conv2DLayer*>(loaded->getLayers()[0].get());
+  auto* pool = dynamic_cast<Pooling2DLayer*>(loaded->getLayers()[1].get());
+  assert(conv && conv->getLayout() == Layout::NHWC);
+  assert(pool && pool->getLayout() == Layout::NHWC);
+
+  Matrix X = Matrix::random(3, INPUT.flat());
+  assert(same(net->predict(X), loaded->predict(X)));
+
+  std::remove("test_layout.nn");
+  std::remove("test_layout.nn.yaml");
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << "   RUNNING LAYOUT TESTS    " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  test_same_function();
+  test_same_gradients();
+  test_save_load();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
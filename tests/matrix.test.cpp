@@ -2,11 +2,18 @@
 
 #include <omp.h>
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <functional>
 #include <iostream>
+#include <vector>
+
+#include "talawa/core/Activation.hpp"
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Tuning.hpp"
 
 using namespace talawa;
 // Helper: Floating point comparison (since 1.000001 != 1.0)
@@ -144,6 +151,101 @@ void test_dot_product() {
 
   std::cout << "Passed. ✅" << std::endl;
 }
+// Naive triple loop used as ground truth for the packed GEMM kernels
+core::Matrix reference_dot(const core::Matrix& A, const core::Matrix& B) {
+  core::Matrix C(A.rows, B.cols);
+  for (size_t i = 0; i < A.rows; ++i) {
+    for (size_t j = 0; j < B.cols; ++j) {
+      double sum = 0.0;
+      for (size_t k = 0; k < A.cols; ++k) sum += A(i, k) * B(k, j);
+      C(i, j) = static_cast<float>(sum);
+    }
+  }
+  return C;
+}
+
+void test_dot_product_blocked() {
+  std::cout << "[Test] Dot Product (Packed GEMM edges & blocking)... ";
+
+  // Shapes chosen to hit partial micro-tiles (e.g. 6x16), multiple K
+  // slabs (KC=256) and multiple row blocks (MC=120)
+  const int shapes[][3] = {{1, 1, 1},    {5, 7, 3},     {6, 16, 8},
+                           {13, 33, 17}, {121, 50, 257}, {64, 300, 520}};
+  for (const auto& s : shapes) {
+    core::Matrix A = core::Matrix::random(s[0], s[1]);
+    core::Matrix B = core::Matrix::random(s[1], s[2]);
+    core::Matrix expected = reference_dot(A, B);
+
+    core::Matrix C = A.dot(B);
+    core::Matrix C_T = A.dotWithBTransposed(B.transpose());
+    for (size_t i = 0; i < expected.rows; ++i) {
+      for (size_t j = 0; j < expected.cols; ++j) {
+        float tol = 1e-4f * s[1];
+        assert(is_close(C(i, j), expected(i, j), tol));
+        assert(is_close(C_T(i, j), expected(i, j), tol));
+      }
+    }
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+void test_transpose_free_dot() {
+  std::cout << "[Test] Transpose-free dotTN / dotNT... ";
+
+  const int shapes[][3] = {{3, 4, 5}, {37, 19, 70}, {300, 9, 33}};
+  for (const auto& s : shapes) {
+    // dotTN: A^T . B with A (k x n), B (k x m)
+    core::Matrix A = core::Matrix::random(s[0], s[1]);
+    core::Matrix B = core::Matrix::random(s[0], s[2]);
+    core::Matrix expected_tn = reference_dot(A.transpose(), B);
+    core::Matrix tn = A.dotTN(B);
+    assert(tn.rows == expected_tn.rows && tn.cols == expected_tn.cols);
+
+    // dotNT: A . C^T with A (k x n), C (m x n)
+    core::Matrix C = core::Matrix::random(s[2], s[1]);
+    core::Matrix expected_nt = reference_dot(A, C.transpose());
+    core::Matrix nt;
+    A.dotNT(C, nt);
+    assert(nt.rows == expected_nt.rows && nt.cols == expected_nt.cols);
+
+    float tol = 1e-4f * s[0];
+    for (size_t i = 0; i < tn.rows; ++i)
+      for (size_t j = 0; j < tn.cols; ++j)
+        assert(is_close(tn(i, j), expected_tn(i, j), tol));
+    for (size_t i = 0; i < nt.rows; ++i)
+      for (size_t j = 0; j < nt.cols; ++j)
+        assert(is_close(nt(i, j), expected_nt(i, j), tol));
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+void test_pooled_storage() {
+  std::cout << "[Test] Aligned, pooled storage... ";
+
+  auto& pool = core::memory::pool();
+  pool.resetStats();
+
+  for (int i = 0; i < 10; ++i) {
+    core::Matrix tmp(33, 17);  // Freed at the end of every iteration
+    assert(reinterpret_cast<uintptr_t>(tmp.rawData()) %
+               core::memory::ALIGNMENT ==
+           0);
+  }
+  auto stats = pool.stats();
+  // Only the first buffer may come from the system heap
+  assert(stats.misses <= 1);
+  assert(stats.hits >= 9);
+  assert(stats.bytes_held > 0);
+
+  // Copies own their storage
+  core::Matrix a = core::Matrix::ones(4, 4);
+  core::Matrix b = a;
+  b(0, 0) = 5.0f;
+  assert(is_close(a(0, 0), 1.0f));
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
 double test_speed(int size = 1000) {
   std::cout << "[Test] Speed Test (" << size << "x" << size << " . " << size
             << "x" << size << " Dot Product)... ";
@@ -162,6 +264,303 @@ double test_speed(int size = 1000) {
   return duration.count();
 }
 
+void test_matrix_view() {
+  std::cout << "[Test] Zero-copy MatrixView... ";
+
+  core::Matrix M = core::Matrix::random(40, 30);
+
+  // Row ranges alias the parent storage
+  core::ConstMatrixView rows = M.rowRange(10, 20);
+  assert(rows.rows == 10 && rows.cols == 30);
+  assert(rows.rawData() == M.rawData() + 10 * 30);
+  assert(core::Matrix(rows) == M.slice(10, 20));
+
+  // Strided sub-block as a GEMM operand, written into a sub-block of 'out'
+  core::ConstMatrixView A = M.view().block(5, 3, 12, 8);  // stride 30
+  core::Matrix B = core::Matrix::random(8, 7);
+  core::Matrix out(20, 20);
+  A.dot(B, out.view().block(4, 6, 12, 7));
+
+  core::Matrix expected = reference_dot(core::Matrix(A), B);
+  for (size_t i = 0; i < out.rows; ++i) {
+    for (size_t j = 0; j < out.cols; ++j) {
+      bool inside = i >= 4 && i < 16 && j >= 6 && j < 13;
+      float want = inside ? expected(i - 4, j - 6) : 0.0f;
+      assert(is_close(out(i, j), want, 1e-4f));
+    }
+  }
+
+  // A . C^T with both operands strided
+  core::ConstMatrixView C = M.view().block(20, 10, 9, 8);
+  core::Matrix nt(12, 9);
+  A.dotNT(C, nt);
+  core::Matrix expected_nt =
+      reference_dot(core::Matrix(A), core::Matrix(C).transpose());
+  for (size_t i = 0; i < nt.rows; ++i)
+    for (size_t j = 0; j < nt.cols; ++j)
+      assert(is_close(nt(i, j), expected_nt(i, j), 1e-4f));
+
+  // In-place ops only touch the viewed block
+  core::MatrixView W = M.view().block(0, 0, 3, 4);
+  W.fill(1.0f);
+  W += core::Matrix({{1, 2, 3, 4}});  // Row broadcast
+  W *= 2.0f;
+  assert(M(2, 3) == 10.0f && M(0, 0) == 4.0f);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+void test_fused_expressions() {
+  std::cout << "[Test] Fused element-wise expressions... ";
+
+  core::Matrix a = core::Matrix::random(300, 130);  // Large: parallel path
+  core::Matrix b = core::Matrix::random(300, 130);
+  core::Matrix c = core::Matrix::random(300, 130);
+  core::Matrix bias = core::Matrix::random(1, 130);
+
+  core::Matrix r = a * 0.25f + b * 0.75f - a.hadamard(c) + bias;
+  for (size_t i = 0; i < r.rows; ++i) {
+    for (size_t j = 0; j < r.cols; ++j) {
+      float want =
+          a(i, j) * 0.25f + b(i, j) * 0.75f - a(i, j) * c(i, j) + bias(0, j);
+      assert(is_close(r(i, j), want, 1e-5f));
+    }
+  }
+
+  // In-place soft update reads and writes the same buffer
+  core::Matrix dst = b;
+  const float* before = dst.rawData();
+  dst = a * 0.1f + dst * 0.9f;
+  assert(dst.rawData() == before);
+  assert(is_close(dst(7, 9), a(7, 9) * 0.1f + b(7, 9) * 0.9f, 1e-6f));
+
+  // Temporaries are kept alive by the expression
+  core::Matrix col = core::Matrix::random(4, 1);
+  auto diff = col - core::Matrix({{1, 2, 3, 4}}).transpose();
+  core::Matrix d = diff;
+  assert(is_close(d(2, 0), col(2, 0) - 3.0f));
+
+  // Overlapping (shifted) views are evaluated through a fresh buffer
+  core::Matrix s = core::Matrix::random(6, 4);
+  core::Matrix s_copy = s;
+  s = s.rowRange(1, 6) - s.rowRange(0, 5);
+  assert(s.rows == 5);
+  assert(is_close(s(0, 0), s_copy(1, 0) - s_copy(0, 0)));
+
+  bool threw = false;
+  try {
+    core::Matrix bad = a - bias;  // Only + broadcasts a row
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+void test_simd_dispatch() {
+  std::cout << "[Test] SIMD kernels at every supported tier... ";
+
+  core::Matrix A = core::Matrix::random(37, 70);
+  core::Matrix B = core::Matrix::random(70, 45);
+  core::Matrix expected = reference_dot(A, B);
+
+  const core::cpu::SimdLevel levels[] = {
+      core::cpu::SimdLevel::SCALAR, core::cpu::SimdLevel::SSE4,
+      core::cpu::SimdLevel::AVX2, core::cpu::SimdLevel::AVX512};
+  for (auto level : levels) {
+    // Tiers the CPU lacks are clamped down, so this is safe everywhere
+    core::kernels::force(level);
+    assert(core::kernels::active().level <= core::cpu::detectedLevel());
+
+    core::Matrix C = A.dot(B);
+    for (size_t i = 0; i < C.rows; ++i)
+      for (size_t j = 0; j < C.cols; ++j)
+        assert(is_close(C(i, j), expected(i, j), 1e-4f * 70));
+
+    // Element-wise kernels: odd length to hit every remainder path
+    core::Matrix x = core::Matrix::random(3, 37);
+    core::Matrix y = x;
+    y.view() += x;
+    y.view() *= 0.5f;
+    assert(y == x);
+    core::Matrix col_sums(3, 1);
+    x.reduceToCol(col_sums);
+    float want = 0.0f;
+    for (size_t j = 0; j < x.cols; ++j) want += x(2, j);
+    assert(is_close(col_sums(2, 0), want, 1e-4f));
+  }
+  core::kernels::reset();
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+void test_transcendental_kernels() {
+  std::cout << "[Test] exp/tanh/sigmoid/softmax accuracy at every tier... ";
+
+  // Dense sweep over the useful range plus saturating inputs
+  std::vector<float> xs;
+  for (float x = -90.0f; x <= 90.0f; x += 0.0137f) xs.push_back(x);
+  for (float x : {0.0f, -0.0f, 1e-6f, -1e-6f, 0.624f, 0.626f, 1e4f, -1e4f})
+    xs.push_back(x);
+  size_t n = xs.size();
+
+  auto rel = [](float got, double want) {
+    return std::abs(got - want) / std::max(std::abs(want), 1e-30);
+  };
+
+  const core::cpu::SimdLevel levels[] = {
+      core::cpu::SimdLevel::SCALAR, core::cpu::SimdLevel::SSE4,
+      core::cpu::SimdLevel::AVX2, core::cpu::SimdLevel::AVX512};
+  for (auto level : levels) {
+    core::kernels::force(level);
+    const auto& k = core::kernels::active();
+
+    std::vector<float> e(n), s = xs, t = xs;
+    k.exp(e.data(), xs.data(), n);
+    k.sigmoid(s.data(), n);
+    k.tanh(t.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      double x = xs[i];
+      if (x > -87.0 && x < 88.0) assert(rel(e[i], std::exp(x)) < 1e-6);
+      if (x > -87.0) assert(rel(s[i], 1.0 / (1.0 + std::exp(-x))) < 1e-6);
+      assert(rel(t[i], std::tanh(x)) < 1e-6);
+    }
+
+    // Softmax rows: large logits must not overflow, output is clipped
+    core::Matrix logits = core::Matrix::random(5, 37);
+    logits.view() *= 50.0f;
+    logits(0, 3) = 1000.0f;
+    core::Matrix probs = core::Activation(core::Activation::SOFTMAX)
+                             .apply(logits);
+    for (size_t r = 0; r < probs.rows; ++r) {
+      double max_val = logits(r, 0), total = 0.0;
+      for (size_t c = 0; c < logits.cols; ++c)
+        max_val = std::max<double>(max_val, logits(r, c));
+      for (size_t c = 0; c < logits.cols; ++c)
+        total += std::exp(logits(r, c) - max_val);
+      for (size_t c = 0; c < probs.cols; ++c) {
+        double want = std::exp(logits(r, c) - max_val) / total;
+        want = std::clamp(want, 1e-7, 1.0 - 1e-7);
+        assert(std::abs(probs(r, c) - want) < 1e-6 * want + 1e-7);
+      }
+    }
+  }
+  core::kernels::reset();
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_fused_epilogue() {
+  std::cout << "[Test] GEMM + bias + activation epilogue... ";
+
+  // k > KC so the epilogue must wait for the last K slab; odd m/n hit edges
+  core::Matrix X = core::Matrix::random(37, 300);
+  core::Matrix W = core::Matrix::random(300, 45);
+  core::Matrix b = core::Matrix::random(1, 45);
+  core::Matrix z_want = reference_dot(X, W);
+  z_want += b;
+
+  for (auto type : {core::Activation::LINEAR, core::Activation::RELU,
+                    core::Activation::TANH, core::Activation::SOFTMAX}) {
+    core::Activation act(type);
+    core::Matrix a_want = act.apply(z_want);
+
+    core::Matrix a, z;
+    act.applyAffine(X, W, b, a, &z);
+    for (size_t i = 0; i < a.rows; ++i) {
+      for (size_t j = 0; j < a.cols; ++j) {
+        assert(is_close(z(i, j), z_want(i, j), 1e-4f * 300));
+        assert(is_close(a(i, j), a_want(i, j), 1e-4f * 300));
+      }
+    }
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_gathered_gemm() {
+  std::cout << "[Test] GEMM with gathered operands... ";
+
+  // Small blocks so the gathers run over many panels and edge tiles
+  core::tuning::Config small;
+  small.mc = 24;
+  small.kc = 40;
+  small.nc = 48;
+  small.gemm_parallel_ops = 0;
+  core::tuning::set(small);
+
+  core::Matrix A = core::Matrix::random(53, 97);
+  core::Matrix B = core::Matrix::random(97, 61);
+  core::Matrix At = A.transpose(), Bt = B.transpose();
+  core::Matrix expected = reference_dot(A, B);
+
+  // Reads come through the gather only, never as one block
+  struct RowMajor {
+    const core::Matrix& R;
+    void operator()(int row, int col, int count, float* dst) const {
+      std::copy_n(R.rawData() + row * R.cols + col, count, dst);
+    }
+  };
+  core::gemm::Operand a{A.rawData(), static_cast<std::ptrdiff_t>(A.cols), 1};
+  core::gemm::Operand b{B.rawData(), static_cast<std::ptrdiff_t>(B.cols), 1};
+
+  auto check = [&](const core::Matrix& C) {
+    for (size_t i = 0; i < C.rows; ++i)
+      for (size_t j = 0; j < C.cols; ++j)
+        assert(is_close(C(i, j), expected(i, j), 1e-4f * 97));
+  };
+  for (bool transposed : {false, true}) {
+    core::Matrix C1(53, 61), C2(53, 61), C3(53, 61);
+    RowMajor reader_a{transposed ? At : A}, reader_b{transposed ? Bt : B};
+    core::gemm::Gathered gathered_a = core::gemm::gather(reader_a, transposed);
+    core::gemm::Gathered gathered_b = core::gemm::gather(reader_b, transposed);
+    core::gemm::sgemm(53, 61, 97, gathered_a, b, C1.rawData(), 61);
+    core::gemm::sgemm(53, 61, 97, a, gathered_b, C2.rawData(), 61);
+    core::gemm::PackedB packed(97, 61, b);
+    core::gemm::sgemm(53, gathered_a, packed, C3.rawData(), 61);
+    check(C1);
+    check(C2);
+    check(C3);
+  }
+
+  core::tuning::set(core::tuning::Config{});
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_tuning_config() {
+  std::cout << "[Test] Tuned blocking & tuning file... ";
+
+  // Tiny blocks force many panels, edge tiles and the parallel paths
+  core::tuning::Config tiny;
+  tiny.mc = 12;
+  tiny.kc = 16;
+  tiny.nc = 32;
+  tiny.gemm_parallel_ops = 0;
+  tiny.transpose_block = 4;
+  tiny.transpose_parallel_elems = 0;
+  core::tuning::set(tiny);
+
+  core::Matrix A = core::Matrix::random(50, 70);
+  core::Matrix B = core::Matrix::random(70, 90);
+  core::Matrix expected = reference_dot(A, B);
+  core::Matrix C = A.dot(B);
+  for (size_t i = 0; i < C.rows; ++i)
+    for (size_t j = 0; j < C.cols; ++j)
+      assert(is_close(C(i, j), expected(i, j), 1e-4f * 70));
+  core::Matrix At = A.transpose();
+  assert(At(69, 3) == A(3, 69) && At(5, 49) == A(49, 5));
+
+  // Round trip through a tuning file
+  std::string path = "test_tuning.yaml";
+  assert(core::tuning::save(tiny, path));
+  auto loaded = core::tuning::load(path);
+  assert(loaded.has_value());
+  assert(loaded->mc == 12 && loaded->kc == 16 && loaded->nc == 32);
+  assert(loaded->transpose_block == 4);
+  std::remove(path.c_str());
+  assert(!core::tuning::load(path).has_value());
+
+  core::tuning::set(core::tuning::Config{});
+  std::cout << "Passed. ✅" << std::endl;
+}
 void test_equality() {
   std::cout << "[Test] Equality Operator... ";
 
@@ -189,7 +588,17 @@ int main() {
   test_scalar_operations();
   test_transpose();
   test_dot_product();
+  test_dot_product_blocked();
+  test_transpose_free_dot();
   test_equality();
+  test_pooled_storage();
+  test_matrix_view();
+  test_fused_expressions();
+  test_simd_dispatch();
+  test_transcendental_kernels();
+  test_fused_epilogue();
+  test_gathered_gemm();
+  test_tuning_config();
 
   double total_duration = 0.0;
   int iterations = 15;
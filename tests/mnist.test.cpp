@@ -78,26 +78,24 @@ int main() {
                 << " at epoch " << epoch + 1 << std::endl;
       batch_size = 128;  // Increase batch size for stability
     }
-    data.shuffle();
+    data.shuffleRows();
     MEASURE_SCOPE("Epoch " + std::to_string(epoch + 1));
 
     float total_loss = 0.0f;
     int batches = 0;
 
     int numBatches = num_samples / batch_size;
-    Matrix batch_X(batch_size, data.features.cols);
-    Matrix batch_Y(batch_size, data.labels.cols);
     // Loop over batches
     for (int i = 0; i < numBatches; i++) {
       int start = i * batch_size;
       int end = std::min(start + batch_size, num_samples);
       std::cout << "\r Processing Batch " << (i + 1) << "/" << numBatches
                 << std::flush;
-      // 1. Get Batch
-      data.splice(start, end, batch_X, batch_Y);
+      // 1. Get Batch (views into the shuffled dataset, no copies)
+      auto batch = data.batch(start, end);
 
       // 2. Train on Batch
-      float loss = model->train(batch_X, batch_Y);
+      float loss = model->train(batch.features, batch.labels);
 
       total_loss += loss;
       batches++;
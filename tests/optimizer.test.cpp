@@ -0,0 +1,390 @@
+#include "talawa/core/Optimizer.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "talawa/core/Kernels.hpp"
+#include "talawa/core/Parallel.hpp"
+#include "talawa/neuralnetwork/NeuralNetwork.hpp"
+
+using namespace talawa;
+using namespace talawa::core;
+using namespace talawa::nn;
+
+// Tensors of very different sizes, so the engine's slices straddle them
+const int SIZES[][2] = {{1, 1}, {3, 7}, {300, 250}, {1, 5}, {64, 1000}};
+
+// Every test runs at each SIMD tier
+const cpu::SimdLevel LEVELS[] = {cpu::SimdLevel::SCALAR, cpu::SimdLevel::SSE4,
+                                 cpu::SimdLevel::AVX2, cpu::SimdLevel::AVX512};
+
+struct Problem {
+  std::vector<Matrix> params, grads;
+  std::vector<Matrix*> param_ptrs, grad_ptrs;
+
+  Problem() {
+    for (auto [rows, cols] : SIZES) {
+      params.push_back(Matrix::random(rows, cols));
+      grads.push_back(Matrix::random(rows, cols) -
+                      Matrix::ones(rows, cols) * 0.5f);
+    }
+    link();
+  }
+  Problem(const Problem& other) : params(other.params), grads(other.grads) {
+    link();
+  }
+
+  void link() {
+    for (size_t i = 0; i < params.size(); ++i) {
+      param_ptrs.push_back(&params[i]);
+      grad_ptrs.push_back(&grads[i]);
+    }
+  }
+};
+
+// Max relative difference against a reference update of every element
+template <typename Ref>
+float worst_error(const Problem& before, const Problem& after, Ref ref) {
+  float worst = 0.0f;
+  for (size_t t = 0; t < before.params.size(); ++t) {
+    for (size_t i = 0; i < before.params[t].size(); ++i) {
+      double expected = ref(before.params[t].rawData()[i],
+                            before.grads[t].rawData()[i]);
+      double got = after.params[t].rawData()[i];
+      double err = std::abs(got - expected) / (1.0 + std::abs(expected));
+      worst = std::max(worst, static_cast<float>(err));
+    }
+  }
+  return worst;
+}
+
+void test_matches_reference() {
+  std::cout << "[Test] Fused optimizers match their formulas at every tier... ";
+
+  const double lr = 0.01, b1 = 0.9, b2 = 0.999, eps = 1e-8, wd = 0.1;
+
+  for (auto level : LEVELS) {
+    kernels::force(level);
+    Problem start;
+
+    // SGD
+    Problem sgd = start;
+    SGD plain;
+    plain.set_learning_rate(lr);
+    plain.update(sgd.param_ptrs, sgd.grad_ptrs);
+    assert(worst_error(start, sgd, [&](double p, double g) {
+             return p - lr * g;
+           }) < 1e-6f);
+
+    // Momentum: two steps with the same gradient -> v = g, then 1.9 g
+    Problem mom = start;
+    MomentumSGD momentum(0.9f);
+    momentum.set_learning_rate(lr);
+    momentum.update(mom.param_ptrs, mom.grad_ptrs);
+    momentum.update(mom.param_ptrs, mom.grad_ptrs);
+    assert(worst_error(start, mom, [&](double p, double g) {
+             return p - lr * g - lr * 1.9 * g;
+           }) < 1e-6f);
+
+    // Adam and AdamW, two steps each (bias corrections at t = 1 and 2)
+    for (bool decoupled : {false, true}) {
+      Problem adam = start;
+      Adam plain_adam;
+      AdamW adamw(wd);
+      Adam& opt = decoupled ? adamw : plain_adam;
+      opt.set_learning_rate(lr);
+      opt.update(adam.param_ptrs, adam.grad_ptrs);
+      opt.update(adam.param_ptrs, adam.grad_ptrs);
+
+      float err = worst_error(start, adam, [&](double p, double g) {
+        double m = 0, v = 0;
+        for (int t = 1; t <= 2; ++t) {
+          m = b1 * m + (1 - b1) * g;
+          v = b2 * v + (1 - b2) * g * g;
+          double m_hat = m / (1 - std::pow(b1, t));
+          double v_hat = v / (1 - std::pow(b2, t));
+          if (decoupled) p -= lr * wd * p;
+          p -= lr * m_hat / (std::sqrt(v_hat) + eps);
+        }
+        return p;
+      });
+      assert(err < 1e-6f);
+    }
+  }
+  kernels::reset();
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_zero_gradients() {
+  std::cout << "[Test] Adam leaves parameters with zero gradients alone... ";
+
+  // v = 0 must not turn into inf/NaN in the reciprocal square root
+  Matrix p = Matrix::random(4, 33), g = Matrix::zeros(4, 33);
+  Matrix before = p;
+  Adam adam;
+  adam.set_learning_rate(0.1f);
+  adam.update({&p}, {&g});
+  assert(p == before);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_rejects_mismatch() {
+  std::cout << "[Test] Gradients must match their parameters... ";
+
+  Matrix p(3, 3), g(3, 4);
+  bool threw = false;
+  try {
+    SGD().update({&p}, {&g});
+  } catch (const std::runtime_error&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_quantized_state() {
+  std::cout << "[Test] Quantised Adam moments: size and determinism... ";
+
+  const size_t n = 300 * 250 + 64 * 1000 + 1 + 21 + 5;
+  size_t scales = 0;  // Two float scales per started block of each tensor
+  for (auto [rows, cols] : SIZES) {
+    size_t count = static_cast<size_t>(rows) * cols;
+    scales += 2 * sizeof(float) *
+              ((count + kernels::Q8_BLOCK - 1) / kernels::Q8_BLOCK);
+  }
+
+  for (auto level : LEVELS) {
+    kernels::force(level);
+    for (auto precision : {MomentPrecision::BF16, MomentPrecision::INT8}) {
+      // The first step starts from zero moments, so it is exactly Adam's
+      Problem start;
+      Problem first = start, reference = start;
+      QuantizedAdam quantized(precision);
+      Adam adam;
+      quantized.set_learning_rate(0.01f);
+      adam.set_learning_rate(0.01f);
+      quantized.update(first.param_ptrs, first.grad_ptrs);
+      adam.update(reference.param_ptrs, reference.grad_ptrs);
+      assert(worst_error(reference, first,
+                         [](double p, double) { return p; }) < 1e-6f);
+
+      // Same result on 1 and 4 threads: the rounding noise follows the
+      // element, not the slice
+      Problem serial = start, threaded = start;
+      QuantizedAdam a(precision), b(precision);
+      a.set_learning_rate(0.01f);
+      b.set_learning_rate(0.01f);
+      for (int step = 0; step < 3; ++step) {
+        parallel::setThreadBudget(1);
+        a.update(serial.param_ptrs, serial.grad_ptrs);
+        parallel::setThreadBudget(4);
+        b.update(threaded.param_ptrs, threaded.grad_ptrs);
+      }
+      for (size_t t = 0; t < serial.params.size(); ++t) {
+        assert(serial.params[t] == threaded.params[t]);
+      }
+
+      // Adam holds 8 bytes per parameter; bf16 4, int8 2 plus block scales
+      size_t expected =
+          precision == MomentPrecision::BF16 ? 4 * n : 2 * n + scales;
+      assert(a.stateBytes() == expected);
+      assert(a.bytesSaved() == 8 * n - expected);
+    }
+  }
+  kernels::reset();
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+// A small MNIST-like task: noisy copies of 10 random 64-pixel prototypes
+void make_digits(Matrix& X, Matrix& Y, int rows) {
+  Matrix prototypes = Matrix::random(10, 64);
+  Matrix noise = Matrix::random(rows, 64);
+  X = Matrix(rows, 64);
+  Y = Matrix::zeros(rows, 10);
+  for (int r = 0; r < rows; ++r) {
+    int label = r % 10;
+    for (int c = 0; c < 64; ++c) {
+      X(r, c) = prototypes(label, c) + noise(r, c) - 0.5f;
+    }
+    Y(r, label) = 1.0f;
+  }
+}
+
+void test_quantized_convergence() {
+  std::cout << "[Test] Quantised Adam converges like Adam... ";
+
+  Matrix X, Y;
+  make_digits(X, Y, 640);
+  auto base = NeuralNetworkBuilder::create({1, 1, 64})
+                  .add(DenseLayerConfig{.neurons = 32, .act = Activation::TANH})
+                  .add(DenseLayerConfig{.neurons = 10,
+                                        .act = Activation::SOFTMAX})
+                  .setOptimizer(std::make_unique<Adam>())
+                  .setLossFunction(std::make_unique<loss::CrossEntropyLoss>())
+                  .build(0.005f);
+
+  // Final epoch's mean loss and the optimizer's state size
+  auto run = [&](std::unique_ptr<Optimizer> opt) {
+    auto net = base->clone();
+    if (opt) {
+      net->optimizer = std::move(opt);
+      net->set_learning_rate(0.005f);
+    }
+    float loss = 0.0f;
+    for (int epoch = 0; epoch < 20; ++epoch) {
+      loss = 0.0f;
+      for (int r = 0; r < X.rows; r += 64) {
+        loss += net->train(X.rowRange(r, r + 64), Y.rowRange(r, r + 64));
+      }
+      loss /= 10.0f;
+    }
+    return std::make_pair(loss, net->optimizer->stateBytes());
+  };
+
+  auto [adam_loss, adam_bytes] = run(nullptr);
+  auto [bf16_loss, bf16_bytes] =
+      run(std::make_unique<QuantizedAdam>(MomentPrecision::BF16));
+  auto [int8_loss, int8_bytes] =
+      run(std::make_unique<QuantizedAdam>(MomentPrecision::INT8));
+
+  std::cout << "\n  fp32 moments: loss " << adam_loss << ", " << adam_bytes
+            << " bytes\n  bf16 moments: loss " << bf16_loss << ", "
+            << bf16_bytes << " bytes (" << adam_bytes - bf16_bytes
+            << " saved)\n  int8 moments: loss " << int8_loss << ", "
+            << int8_bytes << " bytes (" << adam_bytes - int8_bytes
+            << " saved)\n  ";
+  assert(std::abs(bf16_loss - adam_loss) < 0.02f + 0.1f * adam_loss);
+  assert(std::abs(int8_loss - adam_loss) < 0.02f + 0.1f * adam_loss);
+  assert(2 * bf16_bytes == adam_bytes && 3 * int8_bytes < adam_bytes);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_split_steps() {
+  std::cout << "[Test] A step split per tensor range equals a full step... ";
+
+  Problem start;
+  Problem whole = start, split = start;
+  Adam a, b;
+  a.set_learning_rate(0.01f);
+  b.set_learning_rate(0.01f);
+  for (int step = 0; step < 3; ++step) {
+    a.update(whole.param_ptrs, whole.grad_ptrs);
+    // Back to front, like a backward pass
+    b.beginStep(split.param_ptrs, split.grad_ptrs);
+    b.updateTensors(split.param_ptrs, split.grad_ptrs, 3, 5);
+    b.updateTensors(split.param_ptrs, split.grad_ptrs, 1, 3);
+    b.updateTensors(split.param_ptrs, split.grad_ptrs, 0, 1);
+  }
+  assert(worst_error(whole, split, [](double p, double) { return p; }) <
+         1e-6f);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_gradient_clipping() {
+  std::cout << "[Test] Gradient-norm clipping... ";
+
+  // |g| = 5 is clipped to 1; a step of SGD with lr 1 then moves p by g / 5
+  Matrix p = Matrix::zeros(1, 2), g(1, 2);
+  g(0, 0) = 3.0f;
+  g(0, 1) = 4.0f;
+  SGD sgd;
+  sgd.set_learning_rate(1.0f);
+  sgd.setMaxGradientNorm(1.0f);
+  sgd.update({&p}, {&g});
+  assert(std::abs(p(0, 0) + 0.6f) < 1e-6f && std::abs(p(0, 1) + 0.8f) < 1e-6f);
+
+  // Clipping rescales in place; short gradients are left alone
+  assert(std::abs(g(0, 0) - 0.6f) < 1e-6f);
+  g(0, 0) = 3.0f;
+  g(0, 1) = 4.0f;
+  sgd.setMaxGradientNorm(10.0f);
+  sgd.update({&p}, {&g});
+  assert(std::abs(p(0, 0) + 3.6f) < 1e-5f);
+
+  // Clipping needs the global norm, so the step cannot be split
+  sgd.setMaxGradientNorm(1.0f);
+  assert(!sgd.canSplitSteps());
+  bool threw = false;
+  try {
+    sgd.beginStep({&p}, {&g});
+  } catch (const std::runtime_error&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_per_layer_updates() {
+  std::cout << "[Test] Per-layer updates train like the full step... ";
+
+  Matrix X = Matrix::random(32, 20), Y = Matrix::random(32, 6);
+  auto make = [](std::unique_ptr<Optimizer> opt) {
+    return NeuralNetworkBuilder::create({1, 1, 20})
+        .add(DenseLayerConfig{.neurons = 16, .act = Activation::TANH})
+        .add(DenseLayerConfig{.neurons = 12, .act = Activation::RELU})
+        .add(DenseLayerConfig{.neurons = 6, .act = Activation::LINEAR})
+        .setOptimizer(std::move(opt))
+        .build(0.01f);
+  };
+
+  std::vector<std::unique_ptr<Optimizer>> optimizers;
+  optimizers.push_back(std::make_unique<SGD>());
+  optimizers.push_back(std::make_unique<MomentumSGD>());
+  optimizers.push_back(std::make_unique<Adam>());
+  optimizers.push_back(std::make_unique<QuantizedAdam>());
+  auto clipped = std::make_unique<Adam>();
+  clipped->setMaxGradientNorm(0.1f);  // Falls back to the full step
+  optimizers.push_back(std::move(clipped));
+
+  for (auto& opt : optimizers) {
+    auto full = make(std::move(opt));
+    auto per_layer = full->clone();
+    per_layer->setPerLayerUpdates(true);
+    assert(per_layer->perLayerUpdates() && !full->perLayerUpdates());
+
+    for (int step = 0; step < 5; ++step) {
+      float expected = full->train(X, Y);
+      float loss = per_layer->train(X, Y);
+      assert(std::abs(loss - expected) < 1e-5f * (1.0f + expected));
+    }
+    const float* a = full->parameterData();
+    const float* b = per_layer->parameterData();
+    for (int i = 0; i < full->getTotalParameters(); ++i) {
+      assert(std::abs(a[i] - b[i]) < 1e-5f);
+    }
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << "  RUNNING OPTIMIZER TESTS  " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  // Several threads, so slices really run in parallel
+  parallel::setThreadBudget(4);
+
+  test_matches_reference();
+  test_zero_gradients();
+  test_rejects_mismatch();
+  test_quantized_state();
+  test_quantized_convergence();
+  test_split_steps();
+  test_gradient_clipping();
+  test_per_layer_updates();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
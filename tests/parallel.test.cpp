@@ -0,0 +1,95 @@
+#include "talawa/core/Parallel.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "talawa/core/Matrix.hpp"
+
+using namespace talawa;
+namespace parallel = talawa::core::parallel;
+
+void test_covers_range() {
+  std::cout << "[Test] parallelFor covers every index once... ";
+
+  std::vector<std::atomic<int>> hits(10'007);
+  parallel::parallelFor(0, hits.size(), 16, [&](auto first, auto last) {
+    assert(parallel::inParallel());
+    for (auto i = first; i < last; ++i) hits[i]++;
+  });
+  for (auto& h : hits) assert(h.load() == 1);
+  assert(!parallel::inParallel());
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_nested_loops() {
+  std::cout << "[Test] Nested parallelFor (outer rollouts, inner GEMM)... ";
+
+  // Each outer task runs its own GEMMs, which split again on the same pool
+  core::Matrix A = core::Matrix::random(130, 70);
+  core::Matrix B = core::Matrix::random(70, 90);
+  core::Matrix expected = A.dot(B);
+
+  std::vector<core::Matrix> results(8);
+  std::atomic<long> inner{0};
+  parallel::parallelFor(0, 8, 1, [&](auto first, auto last) {
+    for (auto i = first; i < last; ++i) {
+      results[i] = A.dot(B);
+      parallel::parallelFor(0, 1000, 10, [&](auto lo, auto hi) {
+        inner += hi - lo;
+      });
+    }
+  });
+  assert(inner.load() == 8 * 1000);
+  for (const auto& r : results) {
+    for (size_t i = 0; i < r.rows; ++i)
+      for (size_t j = 0; j < r.cols; ++j)
+        assert(std::abs(r(i, j) - expected(i, j)) < 1e-4f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_exceptions() {
+  std::cout << "[Test] Exceptions propagate to the caller... ";
+
+  bool threw = false;
+  try {
+    parallel::parallelFor(0, 100, 1, [&](auto first, auto) {
+      if (first == 0) throw std::runtime_error("boom");
+    });
+  } catch (const std::runtime_error&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << "   RUNNING PARALLEL TESTS  " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  // Force real workers even on small machines
+  parallel::setThreadBudget(4);
+  assert(parallel::threadBudget() == 4);
+
+  test_covers_range();
+  test_nested_loops();
+  test_exceptions();
+
+  // Budget of 1: everything runs inline on the caller
+  parallel::setThreadBudget(1);
+  test_covers_range();
+
+  parallel::setThreadBudget(0);
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
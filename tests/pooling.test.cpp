@@ -0,0 +1,173 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "TestUtils.hpp"
+#include "talawa/neuralnetwork/Pooling2DLayer.hpp"
+
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+// Position of (channel, y, x) within a row of the given layout
+int index_of(Layout layout, int depth, int height, int width, int d, int y,
+             int x) {
+  return layout == Layout::NHWC ? (y * width + x) * depth + d
+                                : (d * height + y) * width + x;
+}
+
+// Straightforward loops over every window: the output Y for X, and dX for
+// the output gradient dY
+void reference_pool(int depth, int height, int width, int window, int stride,
+                    PoolingType type, Layout layout, const Matrix& X,
+                    const Matrix& dY, Matrix& Y, Matrix& dX) {
+  int OH = (height - window) / stride + 1;
+  int OW = (width - window) / stride + 1;
+  float scale = 1.0f / (window * window);
+  Y = Matrix(X.rows, depth * OH * OW);
+  dX = Matrix(X.rows, X.cols);
+  dX.fill(0.0f);
+  for (size_t b = 0; b < X.rows; ++b) {
+    for (int d = 0; d < depth; ++d) {
+      for (int oy = 0; oy < OH; ++oy) {
+        for (int ox = 0; ox < OW; ++ox) {
+          int out = index_of(layout, depth, OH, OW, d, oy, ox);
+          float best = -std::numeric_limits<float>::infinity(), sum = 0.0f;
+          int best_at = -1;
+          for (int wy = 0; wy < window; ++wy) {
+            for (int wx = 0; wx < window; ++wx) {
+              int at = index_of(layout, depth, height, width, d,
+                                oy * stride + wy, ox * stride + wx);
+              sum += X(b, at);
+              if (X(b, at) > best) {
+                best = X(b, at);
+                best_at = at;
+              }
+            }
+          }
+          if (type == PoolingType::MAX) {
+            Y(b, out) = best;
+            dX(b, best_at) += dY(b, out);
+            continue;
+          }
+          Y(b, out) = sum * scale;
+          for (int wy = 0; wy < window; ++wy) {
+            for (int wx = 0; wx < window; ++wx) {
+              int at = index_of(layout, depth, height, width, d,
+                                oy * stride + wy, ox * stride + wx);
+              dX(b, at) += dY(b, out) * scale;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// Largest relative error of the layer against reference_pool over the
+// training and inference outputs and dX of one batch
+float error_against_reference(int depth, int size, int window, int stride,
+                              PoolingType type, Layout layout) {
+  Pooling2DLayer layer(depth, size, size, type, window, stride, layout);
+  Matrix X = Matrix::random(4, depth * size * size);
+  Matrix dY = Matrix::random(4, layer.getOutputShape().flat());
+  Matrix Y, dX;
+  reference_pool(depth, size, size, window, stride, type, layout, X, dY, Y,
+                 dX);
+  float worst = relative_error(layer.forward(X), Y);
+  worst = std::max(worst, relative_error(layer.forward(X, false), Y));
+  return std::max(worst, relative_error(layer.backward(dY), dX));
+}
+
+void test_max_pooling() {
+  std::cout << "[Test] Max pooling matches a reference... ";
+
+  for (Layout layout : {Layout::NCHW, Layout::NHWC}) {
+    auto error = [&](int depth, int size, int window, int stride) {
+      return error_against_reference(depth, size, window, stride,
+                                     PoolingType::MAX, layout);
+    };
+    assert(error(3, 8, 2, 2) < 1e-5f);
+    // Windows that do not tile the image
+    assert(error(2, 9, 2, 2) < 1e-5f);
+    assert(error(1, 10, 2, 3) < 1e-5f);
+    // Overlapping windows, whose gradients land on shared inputs
+    assert(error(4, 9, 3, 2) < 1e-5f);
+    assert(error(2, 6, 3, 1) < 1e-5f);
+    // More channels than one NHWC unit of work
+    assert(error(37, 6, 2, 2) < 1e-5f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_average_pooling() {
+  std::cout << "[Test] Average pooling matches a reference... ";
+
+  for (Layout layout : {Layout::NCHW, Layout::NHWC}) {
+    auto error = [&](int depth, int size, int window, int stride) {
+      return error_against_reference(depth, size, window, stride,
+                                     PoolingType::AVERAGE, layout);
+    };
+    assert(error(3, 8, 2, 2) < 1e-5f);
+    assert(error(1, 10, 2, 3) < 1e-5f);
+    assert(error(4, 9, 3, 2) < 1e-5f);
+    assert(error(37, 6, 2, 2) < 1e-5f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_batch_sizes() {
+  std::cout << "[Test] Max pooling indices follow the batch size... ";
+
+  // One layer for several batch sizes: the index cache is reused, not
+  // reallocated, and must never hand back a stale winner
+  Pooling2DLayer layer(3, 9, 7, PoolingType::MAX, 3, 2, Layout::NHWC);
+  for (size_t batch : {4, 2, 5}) {
+    Matrix X = Matrix::random(batch, 3 * 9 * 7);
+    Matrix dY = Matrix::random(batch, layer.getOutputShape().flat());
+    Matrix Y, dX;
+    reference_pool(3, 9, 7, 3, 2, PoolingType::MAX, Layout::NHWC, X, dY, Y,
+                   dX);
+    assert(relative_error(layer.forward(X), Y) < 1e-5f);
+    assert(relative_error(layer.backward(dY), dX) < 1e-5f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_ties() {
+  std::cout << "[Test] Max pooling routes ties to the first input... ";
+
+  Pooling2DLayer layer(1, 4, 4, PoolingType::MAX, 2, 2);
+  Matrix X(1, 16);
+  X.fill(1.0f);
+  Matrix dY(1, 4);
+  dY.fill(1.0f);
+  layer.forward(X);
+  Matrix dX = layer.backward(dY);
+  for (int i = 0; i < 16; ++i) {
+    int y = i / 4, x = i % 4;
+    assert(dX(0, i) == (y % 2 == 0 && x % 2 == 0 ? 1.0f : 0.0f));
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << "   RUNNING POOLING TESTS   " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  test_max_pooling();
+  test_average_pooling();
+  test_batch_sizes();
+  test_ties();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}
@@ -105,7 +105,59 @@ int main() {
     return 1;
   }
 
+  // Every parameter (and gradient) lives in the network's flat arenas, in
+  // getParameters() order; copies and loaded networks get their own
+  for (NeuralNetwork* net : {model.get(), cloned.get(), loaded.get()}) {
+    size_t offset = 0;
+    for (auto& layer : net->layers) {
+      auto params = layer->getParameters();
+      auto grads = layer->getParameterGradients();
+      for (size_t j = 0; j < params.size(); ++j) {
+        if (params[j]->rawData() != net->parameterData() + offset ||
+            grads[j]->rawData() != net->gradientData() + offset) {
+          std::cerr << "Parameter outside the network's arena" << std::endl;
+          return 1;
+        }
+        offset += params[j]->size();
+      }
+    }
+  }
+  if (cloned->parameterData() == model->parameterData()) {
+    std::cerr << "Clone shares its parameter arena" << std::endl;
+    return 1;
+  }
+
+  // Assigning a same-size matrix writes through to the arena instead of
+  // detaching the tensor from it
+  Matrix& bound = *cloned->layers[0]->getParameters()[0];
+  const float* slot = bound.rawData();
+  Matrix replacement(bound.rows, bound.cols);
+  replacement.fill(0.5f);
+  bound = std::move(replacement);
+  Matrix& bound_grad = *cloned->layers[0]->getParameterGradients()[0];
+  bound_grad = Matrix(bound_grad.rows, bound_grad.cols);
+  if (bound.rawData() != slot || !bound.isBound() ||
+      cloned->parameterData()[0] != 0.5f ||
+      bound_grad.rawData() != cloned->gradientData() || !bound_grad.isBound()) {
+    std::cerr << "Move-assignment detached a parameter" << std::endl;
+    return 1;
+  }
+
+  // Parameter-only checkpoint: one write, one read
+  const std::string pname = "test_network.nn.params";
+  model->layers[0]->getParameters()[0]->fill(0.25f);
+  if (!model->saveParameters(pname) || !loaded->loadParameters(pname)) {
+    std::cerr << "Parameter checkpoint roundtrip failed" << std::endl;
+    return 1;
+  }
+  if (!(*loaded->layers[0]->getParameters()[0] ==
+        *model->layers[0]->getParameters()[0])) {
+    std::cerr << "Parameter checkpoint mismatch" << std::endl;
+    return 1;
+  }
+
   std::cout << "Save/load roundtrip OK" << std::endl;
   std::cout << "YAML metadata OK" << std::endl;
+  std::cout << "Parameter arena OK" << std::endl;
   return 0;
 }
@@ -0,0 +1,139 @@
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+#include "TestUtils.hpp"
+#include "talawa/neuralnetwork/Conv2DLayer.hpp"
+
+using namespace talawa;
+using namespace talawa::nn;
+using namespace talawa::core;
+
+// Largest relative error of Winograd against the GEMM path with the same
+// weights, over the output, dX and both parameter gradients of one batch
+float error_against_gemm(int depth, int height, int width, int filters,
+                         int padding, Layout layout,
+                         Activation act = Activation::RELU) {
+  Conv2DLayer gemm(depth, height, width, filters, 3, 1, padding,
+                   Initializer::GLOROT_UNIFORM, act, layout,
+                   ConvAlgorithm::GEMM);
+  Conv2DLayer fast(depth, height, width, filters, 3, 1, padding,
+                   Initializer::GLOROT_UNIFORM, act, layout,
+                   ConvAlgorithm::WINOGRAD);
+  assert(gemm.winogradTile() == 0 && fast.winogradTile() > 0);
+  *fast.getParameters()[0] = *gemm.getParameters()[0];
+  *fast.getParameters()[1] = Matrix::random(1, filters);
+  *gemm.getParameters()[1] = *fast.getParameters()[1];
+
+  Matrix X = Matrix::random(3, depth * height * width);
+  Matrix want = gemm.forward(X);
+  float worst = relative_error(fast.forward(X), want);
+  worst = std::max(worst, relative_error(fast.forward(X, false), want));
+
+  // Gradients: dX runs through Winograd too, dW stays a GEMM
+  Matrix dY = Matrix::random(want.rows, want.cols);
+  Matrix dX_want = gemm.backward(dY);
+  worst = std::max(worst, relative_error(fast.backward(dY), dX_want));
+  for (int i = 0; i < 2; ++i) {
+    worst = std::max(worst, relative_error(*fast.getParameterGradients()[i],
+                                           *gemm.getParameterGradients()[i]));
+  }
+  return worst;
+}
+
+void test_small_tiles() {
+  std::cout << "[Test] F(2x2) Winograd matches the GEMM path... ";
+
+  for (Layout layout : {Layout::NCHW, Layout::NHWC}) {
+    // 2x2 and 6x6 outputs
+    assert(error_against_gemm(3, 4, 4, 5, 0, layout) < 1e-4f);
+    assert(error_against_gemm(3, 8, 8, 4, 0, layout, Activation::SIGMOID) <
+           1e-4f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_large_tiles() {
+  std::cout << "[Test] F(4x4) Winograd matches the GEMM path... ";
+
+  for (Layout layout : {Layout::NCHW, Layout::NHWC}) {
+    // Outputs that leave partial tiles at the right and bottom edges
+    assert(error_against_gemm(3, 6, 5, 4, 0, layout) < 1e-4f);
+    assert(error_against_gemm(2, 7, 7, 5, 1, layout, Activation::TANH) <
+           1e-4f);
+    assert(error_against_gemm(8, 16, 16, 12, 1, layout, Activation::LINEAR) <
+           1e-4f);
+    assert(error_against_gemm(16, 10, 10, 20, 0, layout) < 1e-4f);
+    // Softmax runs over each pixel's filters after the output transform
+    assert(error_against_gemm(4, 13, 11, 6, 2, layout, Activation::SOFTMAX) <
+           1e-4f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_selection() {
+  std::cout << "[Test] Winograd is picked for 3x3 stride-1 layers only... ";
+
+  // The tile needing fewer multiplies: 4x4 once outputs are large enough
+  assert(Conv2DLayer(2, 6, 6, 3, 3, 1, 1).winogradTile() == 2);
+  assert(Conv2DLayer(2, 4, 4, 3, 3, 1, 1).winogradTile() == 4);
+  assert(Conv2DLayer(2, 32, 32, 3, 3, 1, 1).winogradTile() == 4);
+  assert(Conv2DLayer(2, 8, 8, 3, 3, 2, 1).winogradTile() == 0);
+  assert(Conv2DLayer(2, 8, 8, 3, 5, 1, 2).winogradTile() == 0);
+  Conv2DLayer forced(2, 8, 8, 3, 3, 1, 1, Initializer::GLOROT_UNIFORM,
+                     Activation::RELU, Layout::NCHW, ConvAlgorithm::GEMM);
+  assert(forced.winogradTile() == 0);
+
+  bool threw = false;
+  try {
+    Conv2DLayer(2, 8, 8, 3, 5, 1, 0, Initializer::GLOROT_UNIFORM,
+                Activation::RELU, Layout::NCHW, ConvAlgorithm::WINOGRAD);
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+void test_filter_cache() {
+  std::cout << "[Test] Transformed filters follow the kernels... ";
+
+  Conv2DLayer layer(3, 12, 12, 4, 3, 1, 1);
+  Conv2DLayer reference(3, 12, 12, 4, 3, 1, 1, Initializer::GLOROT_UNIFORM,
+                        Activation::RELU, Layout::NCHW, ConvAlgorithm::GEMM);
+  Matrix X = Matrix::random(2, 3 * 12 * 12);
+
+  for (int round = 0; round < 3; ++round) {
+    // An in-place update, as the optimizers make
+    Matrix& kernels = *layer.getParameters()[0];
+    for (size_t i = 0; i < kernels.size(); ++i) kernels.rawData()[i] += 0.1f;
+    *reference.getParameters()[0] = kernels;
+
+    Matrix want = reference.forward(X, false);
+    assert(relative_error(layer.forward(X, false), want) < 1e-4f);
+    assert(relative_error(layer.forward(X, false), want) < 1e-4f);
+  }
+
+  std::cout << "Passed. ✅" << std::endl;
+}
+
+int main() {
+  std::cout << "===========================" << std::endl;
+  std::cout << "   RUNNING WINOGRAD TESTS  " << std::endl;
+  std::cout << "===========================" << std::endl;
+
+  test_small_tiles();
+  test_large_tiles();
+  test_selection();
+  test_filter_cache();
+
+  std::cout << "===========================" << std::endl;
+  std::cout << "   ALL TESTS PASSED        " << std::endl;
+  std::cout << "===========================" << std::endl;
+  return 0;
+}